@@ -38,4 +38,12 @@ return {
   gameplay = {
     food_score = 10, -- points per food
   },
+
+  lua = {
+    instruction_budget = 0, -- max VM instructions per Lua call, 0 = unlimited
+  },
+
+  rules = {
+    plugin = "", -- native rule module (.dll/.so) instead of rules.lua, "" = use rules.lua
+  },
 }
@@ -0,0 +1,178 @@
+// Board draw cost on a full 60x60 board (grid + 3600 sprite quads + head flash): one SDL call
+// per line/segment, as Renderer used to draw it, vs. DrawList batches.
+// Build with -DSNAKE_BUILD_BENCH=ON and run `snake_bench_draw_list [frames] [window]`.
+// Without `window` it renders into an offscreen surface with the software renderer; with it,
+// a hidden window and the default (GPU) renderer are used.
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "render/DrawList.h"
+
+namespace {
+
+constexpr int kBoard = 60;
+constexpr int kTile = 16;
+constexpr int kPx = kBoard * kTile;
+
+struct Result {
+    double ms_per_frame = 0.0;
+    int draw_calls = 0;
+};
+
+SDL_Texture* MakeSpriteTexture(SDL_Renderer* r) {
+    // Two 16x16 cells (head, body) side by side, like two atlas entries.
+    std::vector<Uint32> pixels(kTile * 2 * kTile, 0xFF60C060u);
+    for (int y = 0; y < kTile; ++y) {
+        for (int x = 0; x < kTile; ++x) {
+            pixels[y * kTile * 2 + x] = 0xFFF0F078u;
+        }
+    }
+    SDL_Texture* tex = SDL_CreateTexture(r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, kTile * 2, kTile);
+    if (tex != nullptr) {
+        SDL_UpdateTexture(tex, nullptr, pixels.data(), kTile * 2 * 4);
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    }
+    return tex;
+}
+
+SDL_Rect Cell(int i) {
+    // Serpentine path over the whole board.
+    const int y = i / kBoard;
+    const int x = (y % 2 == 0) ? i % kBoard : kBoard - 1 - i % kBoard;
+    return SDL_Rect{x * kTile, y * kTile, kTile, kTile};
+}
+
+template <typename Fn>
+double TimeFrames(SDL_Renderer* r, int frames, Fn&& draw) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; ++f) {
+        SDL_SetRenderDrawColor(r, 0, 0, 0, 255);
+        SDL_RenderClear(r);
+        draw();
+        SDL_RenderPresent(r);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count() / frames;
+}
+
+Result RunImmediate(SDL_Renderer* r, SDL_Texture* tex, int frames) {
+    int calls = 0;
+    auto draw = [&]() {
+        calls = 0;
+        const SDL_Rect board{0, 0, kPx, kPx};
+        SDL_SetRenderDrawColor(r, 32, 32, 42, 255);
+        SDL_RenderFillRect(r, &board);
+        ++calls;
+        SDL_SetRenderDrawColor(r, 48, 48, 58, 255);
+        for (int i = 0; i <= kBoard; ++i) {
+            SDL_RenderDrawLine(r, i * kTile, 0, i * kTile, kPx);
+            SDL_RenderDrawLine(r, 0, i * kTile, kPx, i * kTile);
+            calls += 2;
+        }
+        const SDL_Rect head_src{0, 0, kTile, kTile};
+        const SDL_Rect body_src{kTile, 0, kTile, kTile};
+        for (int i = 0; i < kBoard * kBoard; ++i) {
+            const SDL_Rect dst = Cell(i);
+            SDL_RenderCopy(r, tex, i == 0 ? &head_src : &body_src, &dst);
+            ++calls;
+            if (i == 0) {
+                SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_ADD);
+                SDL_SetRenderDrawColor(r, 255, 255, 255, 40);
+                SDL_RenderFillRect(r, &dst);
+                SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+                ++calls;
+            }
+        }
+    };
+    Result result;
+    result.ms_per_frame = TimeFrames(r, frames, draw);
+    result.draw_calls = calls;
+    return result;
+}
+
+Result RunDrawList(SDL_Renderer* r, SDL_Texture* tex, int frames) {
+    snake::render::DrawList list;
+    auto draw = [&]() {
+        list.ResetStats();
+        list.AddRect(SDL_Rect{0, 0, kPx, kPx}, SDL_Color{32, 32, 42, 255});
+        const SDL_Color grid{48, 48, 58, 255};
+        for (int i = 0; i <= kBoard; ++i) {
+            list.AddRect(SDL_Rect{i * kTile, 0, 1, kPx + 1}, grid);
+            list.AddRect(SDL_Rect{0, i * kTile, kPx + 1, 1}, grid);
+        }
+        const SDL_Rect head_src{0, 0, kTile, kTile};
+        const SDL_Rect body_src{kTile, 0, kTile, kTile};
+        for (int i = 0; i < kBoard * kBoard; ++i) {
+            const SDL_Rect dst = Cell(i);
+            list.AddSprite(tex, i == 0 ? head_src : body_src, dst);
+            if (i == 0) {
+                list.AddRect(dst, SDL_Color{255, 255, 255, 40}, SDL_BLENDMODE_ADD);
+            }
+        }
+        list.Flush(r);
+    };
+    Result result;
+    result.ms_per_frame = TimeFrames(r, frames, draw);
+    result.draw_calls = list.GetStats().draw_calls;
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200;
+    const bool use_window = argc > 2 && std::strcmp(argv[2], "window") == 0;
+
+    SDL_SetMainReady();
+    if (SDL_Init(use_window ? SDL_INIT_VIDEO : 0) != 0) {
+        std::fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Window* window = nullptr;
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* r = nullptr;
+    if (use_window) {
+        window = SDL_CreateWindow("draw list bench", 0, 0, kPx, kPx, SDL_WINDOW_HIDDEN);
+        r = window != nullptr ? SDL_CreateRenderer(window, -1, 0) : nullptr;
+    } else {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, kPx + 1, kPx + 1, 32, SDL_PIXELFORMAT_ARGB8888);
+        r = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    }
+    SDL_Texture* tex = r != nullptr ? MakeSpriteTexture(r) : nullptr;
+    if (tex == nullptr) {
+        std::fprintf(stderr, "renderer setup failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_RendererInfo info{};
+    SDL_GetRendererInfo(r, &info);
+    std::printf("renderer: %s, board %dx%d, %d frames\n", info.name, kBoard, kBoard, frames);
+
+    RunImmediate(r, tex, 10);  // warm-up
+    const Result immediate = RunImmediate(r, tex, frames);
+    RunDrawList(r, tex, 10);
+    const Result batched = RunDrawList(r, tex, frames);
+
+    std::printf("%-10s %12s %12s\n", "path", "draw calls", "ms/frame");
+    std::printf("%-10s %12d %12.3f\n", "immediate", immediate.draw_calls, immediate.ms_per_frame);
+    std::printf("%-10s %12d %12.3f\n", "draw list", batched.draw_calls, batched.ms_per_frame);
+
+    SDL_DestroyTexture(tex);
+    SDL_DestroyRenderer(r);
+    if (surface != nullptr) {
+        SDL_FreeSurface(surface);
+    }
+    if (window != nullptr) {
+        SDL_DestroyWindow(window);
+    }
+    SDL_Quit();
+    return 0;
+}
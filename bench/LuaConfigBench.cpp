@@ -0,0 +1,116 @@
+// Microbenchmark for config reads from Lua: `return <expr>` via luaL_dostring (the old
+// Bindings implementation) vs. cached dotted paths vs. one batched read of the config table.
+// Build with -DSNAKE_BUILD_BENCH=ON and run `snake_bench_lua_config [iterations]`.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "io/Config.h"
+#include "lua/Bindings.h"
+
+namespace {
+
+constexpr const char* kBenchConfig = R"(
+config = {
+    gameplay = {
+        food_score = 10,
+        bonus_score = 50,
+        bonus_score_score = 50,
+        slow_multiplier = 0.70,
+        slow_duration_sec = 6.0,
+        max_simultaneous_bonuses = 2,
+        always_one_food = true,
+    },
+}
+)";
+
+constexpr const char* kIntPaths[] = {
+    "config.gameplay.food_score",
+    "config.gameplay.bonus_score",
+    "config.gameplay.bonus_score_score",
+    "config.gameplay.max_simultaneous_bonuses",
+};
+
+bool DostringInt(lua_State* L, const char* expr, int* out) {
+    const std::string wrapped = "return " + std::string(expr);
+    if (luaL_dostring(L, wrapped.c_str()) != LUA_OK) {
+        lua_pop(L, 1);
+        return false;
+    }
+    const bool ok = lua_isinteger(L, -1);
+    if (ok) {
+        *out = static_cast<int>(lua_tointeger(L, -1));
+    }
+    lua_pop(L, 1);
+    return ok;
+}
+
+template <typename F>
+double NsPerIteration(int iterations, F&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200'000;
+
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+    if (luaL_dostring(L, kBenchConfig) != LUA_OK) {
+        std::fprintf(stderr, "bench config failed: %s\n", lua_tostring(L, -1));
+        lua_close(L);
+        return 1;
+    }
+
+    int sink = 0;
+    const double dostring = NsPerIteration(iterations, [&] {
+        for (const char* p : kIntPaths) {
+            int v = 0;
+            DostringInt(L, p, &v);
+            sink += v;
+        }
+    });
+    const double by_string = NsPerIteration(iterations, [&] {
+        for (const char* p : kIntPaths) {
+            int v = 0;
+            snake::lua::Bindings::GetInt(L, p, &v);
+            sink += v;
+        }
+    });
+    const snake::lua::LuaPath paths[] = {
+        snake::lua::LuaPath(kIntPaths[0]),
+        snake::lua::LuaPath(kIntPaths[1]),
+        snake::lua::LuaPath(kIntPaths[2]),
+        snake::lua::LuaPath(kIntPaths[3]),
+    };
+    const double by_path = NsPerIteration(iterations, [&] {
+        for (const auto& p : paths) {
+            int v = 0;
+            snake::lua::Bindings::GetInt(L, p, &v);
+            sink += v;
+        }
+    });
+    const double batched = NsPerIteration(iterations, [&] {
+        snake::io::Config config;
+        snake::lua::Bindings::ReadConfig(L, &config);
+        sink += config.Data().gameplay.food_score;
+    });
+
+    std::printf("%-40s %10.1f ns\n", "4 ints, luaL_dostring per read", dostring);
+    std::printf("%-40s %10.1f ns\n", "4 ints, GetInt(const char*) cached", by_string);
+    std::printf("%-40s %10.1f ns\n", "4 ints, GetInt(LuaPath)", by_path);
+    std::printf("%-40s %10.1f ns\n", "whole config table, ReadConfig batched", batched);
+    std::printf("(checksum %d)\n", sink);
+
+    lua_close(L);
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Headless, rule-accurate simulation throughput with one pooled Lua state per worker thread.
+// Build with -DSNAKE_BUILD_BENCH=ON and run
+// `snake_bench_lua_sim [ticks_per_thread] [rules.lua] [config.lua]`.
+// Each worker leases a runtime, drives its own Game with random turns and calls
+// speed_ticks_per_sec and the hooks every tick exactly like App does. Work per thread is fixed,
+// so ideal scaling keeps ticks/s growing linearly with the thread count.
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "core/Input.h"
+#include "game/Game.h"
+#include "lua/LuaStatePool.h"
+
+namespace {
+
+constexpr const char* kBenchRules = R"(
+stats = { food = 0, bonus = 0, rounds = 0, ticks = 0 }
+bonus_spawn = { none = 8, bonus_score = 1, bonus_slow = 1 }
+
+function speed_ticks_per_sec(score, config)
+    return math.min(8 / 3 + math.floor(score / 25) / 3, 10)
+end
+
+function on_round_start(ctx) stats.rounds = stats.rounds + 1 end
+function on_tick_end(ctx) stats.ticks = stats.ticks + 1 end
+function on_food_eaten(ctx) stats.food = stats.food + ctx.length end
+function on_bonus_picked(ctx, kind) stats.bonus = stats.bonus + 1 end
+)";
+
+constexpr const char* kBenchConfig = "return { gameplay = { food_score = 10 } }\n";
+
+constexpr SDL_Keycode kTurnKeys[] = {SDLK_UP, SDLK_DOWN, SDLK_LEFT, SDLK_RIGHT};
+
+// Mirrors the per-tick part of App::HandleMenus without rendering, audio or the fixed-step clock.
+long long SimulateWorker(snake::lua::LuaStatePool& pool, long long ticks, unsigned seed) {
+    using snake::lua::Hook;
+
+    auto lua = pool.Acquire();
+    snake::game::Game game;
+    snake::core::Input input;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> turn_dist(0, 3);
+
+    game.SetWrapMode(true);
+    game.SetBonusSpawnWeights(lua->BonusSpawnWeights());
+    lua->SetGame(&game);
+    game.ResetAll();
+    lua->CallHook(Hook::RoundStart);
+
+    long long done = 0;
+    double tps = 10.0;
+    while (done < ticks) {
+        if ((done & 7) == 0) {
+            SDL_Event e{};
+            e.type = SDL_KEYDOWN;
+            e.key.keysym.sym = kTurnKeys[turn_dist(rng)];
+            input.BeginFrame();
+            input.HandleEvent(e);
+            game.HandleInput(input);
+        }
+
+        lua->GetBaseTicksPerSec(game.GetScore().Score(), &tps);
+        lua->CallHook(Hook::TickBegin);
+        game.Tick(1.0 / tps);
+        const auto& events = game.Events();
+        if (events.food_eaten) {
+            lua->CallHook(Hook::FoodEaten);
+        }
+        if (events.bonus_picked) {
+            lua->CallHook(Hook::BonusPicked, events.bonus_type);
+        }
+        ++done;
+        if (game.IsGameOver()) {
+            lua->CallHook(Hook::GameOver, game.GameOverReason());
+            game.ResetAll();
+            lua->CallHook(Hook::RoundStart);
+        } else {
+            lua->CallHook(Hook::TickEnd);
+        }
+    }
+    return done;
+}
+
+std::filesystem::path WriteTemp(const char* name, const char* text) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(path, std::ios::trunc);
+    out << text;
+    return path;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long long ticks = argc > 1 ? std::max(1LL, std::atoll(argv[1])) : 200'000;
+    const bool own_rules = argc <= 2;
+    const bool own_config = argc <= 3;
+    const auto rules_path = own_rules ? WriteTemp("snake_bench_sim_rules.lua", kBenchRules)
+                                      : std::filesystem::path(argv[2]);
+    const auto config_path = own_config ? WriteTemp("snake_bench_sim_config.lua", kBenchConfig)
+                                        : std::filesystem::path(argv[3]);
+
+    const unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned n = 1; n < max_threads; n *= 2) {
+        counts.push_back(n);
+    }
+    counts.push_back(max_threads);
+
+    std::printf("%8s %14s %10s %11s\n", "threads", "ticks/s", "speedup", "efficiency");
+    double base = 0.0;
+    int rc = 0;
+    for (const unsigned n : counts) {
+        snake::lua::LuaStatePool pool;
+        if (!pool.Init(rules_path, config_path, n)) {
+            const auto& err = pool.LastError();
+            std::fprintf(stderr, "pool init failed: %s\n", err ? err->message.c_str() : "?");
+            rc = 1;
+            break;
+        }
+
+        std::vector<std::thread> workers;
+        std::vector<long long> done(n, 0);
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < n; ++i) {
+            workers.emplace_back([&, i] { done[i] = SimulateWorker(pool, ticks, 1234u + i); });
+        }
+        for (auto& t : workers) {
+            t.join();
+        }
+        const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        long long total = 0;
+        for (const long long d : done) {
+            total += d;
+        }
+        const double rate = static_cast<double>(total) / sec;
+        if (base == 0.0) {
+            base = rate;
+        }
+        std::printf("%8u %14.0f %9.2fx %10.0f%%\n", n, rate, rate / base, 100.0 * rate / (base * n));
+    }
+
+    if (own_rules) {
+        std::filesystem::remove(rules_path);
+    }
+    if (own_config) {
+        std::filesystem::remove(config_path);
+    }
+    return rc;
+}
@@ -0,0 +1,164 @@
+// Per-tick cost of the rules backends: rules.lua through LuaRuntime vs. the native sample
+// plugin (plugins/rules_default) through RulesPlugin, on the same headless game loop.
+// Build with -DSNAKE_BUILD_BENCH=ON and run
+// `snake_bench_rules_plugin [ticks] [path/to/snake_rules_default.dll]`.
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "core/Input.h"
+#include "game/Game.h"
+#include "game/RulesPlugin.h"
+#include "lua/Bindings.h"
+#include "lua/LuaRuntime.h"
+
+namespace {
+
+// Same behaviour as the sample plugin: shipped speed curve plus per-event counters.
+constexpr const char* kBenchRules = R"(
+stats = { ticks = 0, food = 0, bonuses = 0, rounds = 0 }
+
+function speed_ticks_per_sec(score, config)
+    local base = 8 / 3
+    local growth = math.floor((score or 0) / 25) / 3
+    return math.min(base + growth, 10)
+end
+
+function on_round_start(ctx) stats.rounds = stats.rounds + 1 end
+function on_tick_end(ctx) stats.ticks = stats.ticks + 1 end
+function on_food_eaten(ctx) stats.food = stats.food + 1 end
+function on_bonus_picked(ctx, kind) stats.bonuses = stats.bonuses + 1 end
+)";
+
+#if defined(_WIN32)
+constexpr const char* kDefaultPlugin = "snake_rules_default.dll";
+#else
+constexpr const char* kDefaultPlugin = "./libsnake_rules_default.so";
+#endif
+
+constexpr SDL_Keycode kTurnKeys[] = {SDLK_UP, SDLK_DOWN, SDLK_LEFT, SDLK_RIGHT};
+
+struct NoRules {
+    bool Speed(int /*score*/, double* tps) { *tps = 10.0; return true; }
+    void RoundStart(const snake::game::Game&) {}
+    void TickBegin(const snake::game::Game&) {}
+    void TickEnd(const snake::game::Game&) {}
+    void FoodEaten(const snake::game::Game&) {}
+    void BonusPicked(const snake::game::Game&, const std::string&) {}
+};
+
+struct LuaRules {
+    snake::lua::LuaRuntime& lua;
+    bool Speed(int score, double* tps) { return lua.GetBaseTicksPerSec(score, tps); }
+    void RoundStart(const snake::game::Game&) { lua.CallHook(snake::lua::Hook::RoundStart); }
+    void TickBegin(const snake::game::Game&) { lua.CallHook(snake::lua::Hook::TickBegin); }
+    void TickEnd(const snake::game::Game&) { lua.CallHook(snake::lua::Hook::TickEnd); }
+    void FoodEaten(const snake::game::Game&) { lua.CallHook(snake::lua::Hook::FoodEaten); }
+    void BonusPicked(const snake::game::Game&, const std::string& t) {
+        lua.CallHook(snake::lua::Hook::BonusPicked, t);
+    }
+};
+
+struct PluginRules {
+    snake::game::RulesPlugin& plugin;
+    bool Speed(int score, double* tps) { return plugin.GetBaseTicksPerSec(score, tps); }
+    void RoundStart(const snake::game::Game& g) { plugin.OnRoundStart(g); }
+    void TickBegin(const snake::game::Game& g) { plugin.OnTickBegin(g); }
+    void TickEnd(const snake::game::Game& g) { plugin.OnTickEnd(g); }
+    void FoodEaten(const snake::game::Game& g) { plugin.OnFoodEaten(g); }
+    void BonusPicked(const snake::game::Game& g, const std::string& t) { plugin.OnBonusPicked(g, t); }
+};
+
+// Same loop as App::HandleMenus / LuaSimBench, same turn sequence for every backend.
+template <typename Rules>
+double NsPerTick(Rules rules, snake::game::Game& game, long long ticks) {
+    snake::core::Input input;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> turn_dist(0, 3);
+    game.SetWrapMode(true);
+    game.ResetAll();
+    rules.RoundStart(game);
+
+    double tps = 10.0;
+    const auto start = std::chrono::steady_clock::now();
+    for (long long done = 0; done < ticks; ++done) {
+        if ((done & 7) == 0) {
+            SDL_Event e{};
+            e.type = SDL_KEYDOWN;
+            e.key.keysym.sym = kTurnKeys[turn_dist(rng)];
+            input.BeginFrame();
+            input.HandleEvent(e);
+            game.HandleInput(input);
+        }
+        rules.Speed(game.GetScore().Score(), &tps);
+        rules.TickBegin(game);
+        game.Tick(1.0 / tps);
+        const auto& events = game.Events();
+        if (events.food_eaten) {
+            rules.FoodEaten(game);
+        }
+        if (events.bonus_picked) {
+            rules.BonusPicked(game, events.bonus_type);
+        }
+        if (game.IsGameOver()) {
+            game.ResetAll();
+            rules.RoundStart(game);
+        } else {
+            rules.TickEnd(game);
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(ticks);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long long ticks = argc > 1 ? std::max(1LL, std::atoll(argv[1])) : 2'000'000;
+    const std::string plugin_path = argc > 2 ? argv[2] : kDefaultPlugin;
+
+    const auto rules_path = std::filesystem::temp_directory_path() / "snake_bench_plugin_rules.lua";
+    {
+        std::ofstream out(rules_path, std::ios::trunc);
+        out << kBenchRules;
+    }
+
+    snake::lua::LuaRuntime lua;
+    if (!lua.Init()) {
+        std::fprintf(stderr, "lua init failed\n");
+        return 1;
+    }
+    snake::lua::Bindings::Register(lua.L());
+    if (!lua.LoadRules(rules_path)) {
+        std::fprintf(stderr, "failed to load %s\n", rules_path.string().c_str());
+        return 1;
+    }
+    std::filesystem::remove(rules_path);
+
+    snake::game::RulesPlugin plugin;
+    std::string error;
+    if (!plugin.Load(plugin_path, &error)) {
+        std::fprintf(stderr, "failed to load plugin %s: %s\n", plugin_path.c_str(), error.c_str());
+        return 1;
+    }
+
+    snake::game::Game game;
+    lua.SetGame(&game);
+    const double none_ns = NsPerTick(NoRules{}, game, ticks);
+    const double lua_ns = NsPerTick(LuaRules{lua}, game, ticks);
+    const double native_ns = NsPerTick(PluginRules{plugin}, game, ticks);
+
+    std::printf("%-22s %12s %14s\n", "backend", "ns/tick", "rules ns/tick");
+    std::printf("%-22s %12.1f %14s\n", "none (engine only)", none_ns, "-");
+    std::printf("%-22s %12.1f %14.1f\n", "rules.lua", lua_ns, lua_ns - none_ns);
+    std::printf("%-22s %12.1f %14.1f\n", plugin.Name().c_str(), native_ns, native_ns - none_ns);
+    return 0;
+}
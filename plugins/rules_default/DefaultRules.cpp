@@ -0,0 +1,71 @@
+// Native port of assets/scripts/rules.lua against the C ABI in src/game/RulesAbi.h.
+// Select it with `rules = { plugin = "snake_rules_default.dll" }` in config.lua.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "game/RulesAbi.h"
+
+namespace {
+
+// Per-instance state; the engine creates one instance per runtime, so no locking is needed.
+struct DefaultRules {
+    std::int64_t ticks = 0;
+    std::int64_t food = 0;
+    std::int64_t bonuses = 0;
+    std::int64_t rounds = 0;
+};
+
+void* Create() {
+    return new DefaultRules();
+}
+
+void Destroy(void* self) {
+    delete static_cast<DefaultRules*>(self);
+}
+
+// Same curve as rules.speed_ticks_per_sec: starts at 8/3 and gains 1/3 every 25 points, capped at 10.
+double SpeedTicksPerSec(void* /*self*/, std::int32_t score) {
+    const double base = 8.0 / 3.0;
+    const double growth = std::floor(static_cast<double>(std::max<std::int32_t>(score, 0)) / 25.0) / 3.0;
+    return std::min(base + growth, 10.0);
+}
+
+void OnRoundStart(void* self, const SnakeRulesCtx* /*ctx*/) {
+    ++static_cast<DefaultRules*>(self)->rounds;
+}
+
+void OnTickEnd(void* self, const SnakeRulesCtx* /*ctx*/) {
+    ++static_cast<DefaultRules*>(self)->ticks;
+}
+
+void OnFoodEaten(void* self, const SnakeRulesCtx* /*ctx*/) {
+    ++static_cast<DefaultRules*>(self)->food;
+}
+
+void OnBonusPicked(void* self, const SnakeRulesCtx* /*ctx*/, const char* /*bonus_type*/) {
+    ++static_cast<DefaultRules*>(self)->bonuses;
+}
+
+const SnakeRulesApi kApi = [] {
+    SnakeRulesApi api{};
+    api.abi_version = SNAKE_RULES_ABI_VERSION;
+    api.struct_size = sizeof(SnakeRulesApi);
+    api.name = "default (native)";
+    api.create = &Create;
+    api.destroy = &Destroy;
+    api.speed_ticks_per_sec = &SpeedTicksPerSec;
+    api.on_round_start = &OnRoundStart;
+    api.on_tick_end = &OnTickEnd;
+    api.on_food_eaten = &OnFoodEaten;
+    api.on_bonus_picked = &OnBonusPicked;
+    // No bonus_spawn table: the engine default matches rules.lua.
+    return api;
+}();
+
+}  // namespace
+
+extern "C" SNAKE_RULES_EXPORT const SnakeRulesApi* snake_rules_get_api(void) {
+    return &kApi;
+}
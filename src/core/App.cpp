@@ -5,8 +5,12 @@
 #include <SDL_ttf.h>
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstdio>
+#include <fstream>
 #include <functional>
+#include <initializer_list>
 #include <stdexcept>
 #include <string_view>
 #include <vector>
@@ -14,6 +18,7 @@
 
 #include "audio/AudioSystem.h"
 #include "audio/SFX.h"
+#include "core/HeapCounter.h"
 #include "io/Paths.h"
 #include "io/Highscores.h"
 #include "lua/Bindings.h"
@@ -23,8 +28,15 @@ namespace snake::core {
 namespace {
 constexpr int kDefaultWindowW = 800;
 constexpr int kDefaultWindowH = 800;
-constexpr int kMaxTicksPerFrame = 10;
+constexpr int kMaxTicksPerFrame = 10;         // real-time cap (time scale 1x)
+constexpr double kTickBudgetSec = 0.012;      // CPU budget for ticks per frame when fast-forwarding
+constexpr int kBudgetCheckInterval = 16;      // ticks between budget clock reads
+constexpr double kAchievedTpsWindowSec = 0.5;
+constexpr std::array<double, 10> kTimeScales{1.0, 2.0, 5.0, 10.0, 25.0, 50.0, 100.0, 250.0, 500.0, 1000.0};
+constexpr std::array<double, 5> kZoomLevels{0.25, 0.5, 1.0, 1.5, 2.0};
 constexpr std::size_t kMaxNameEntryLen = 12;
+constexpr std::size_t kLuaOverlayRows = 8;
+constexpr double kLuaGcBudgetSec = 0.001;
 
 bool IsAllowedNameEntryChar(char c) {
     return std::isalnum(static_cast<unsigned char>(c)) || c == ' ' || c == '_' || c == '-';
@@ -41,7 +53,10 @@ int App::Run() {
     try {
         InitSDL();
         config_path_ = snake::io::UserPath("config.lua");
-        pending_config_.LoadFromFile(config_path_);
+        InitLua();  // also fills pending_config_ from the same config.lua run
+        if (!lua_.IsReady()) {
+            pending_config_.LoadFromFile(config_path_);
+        }
         active_config_ = pending_config_;
         const auto highscores_path = snake::io::UserPath("highscores.json");
         highscores_.Load(highscores_path);
@@ -51,10 +66,8 @@ int App::Run() {
         window_h_ = pending_config_.Data().window.height;
 
         CreateWindowAndRenderer(pending_config_.Data().window.vsync);
-        renderer_impl_.Init(renderer_);
+        renderer_impl_.Init(renderer_, &asset_cache_);
         time_.Init();
-        lua_ctx_.game = &game_;
-        lua_ctx_.audio = &audio_;
 
         audio_.Init();
         sfx_.SetAudioSystem(&audio_);
@@ -62,10 +75,10 @@ int App::Run() {
         ApplyConfig();
         ApplyAudioSettings();
         ApplyImmediateSettings(active_config_.Data(), pending_config_.Data());
-        InitLua();
 
         bool running = true;
         while (running) {
+            const std::uint64_t heap_at_frame_start = HeapAllocationCount();
             input_.BeginFrame();
             window_resized_ = false;
 
@@ -94,6 +107,10 @@ int App::Run() {
                     }
                 }
 
+                if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+                    renderer_impl_.InvalidateCaches();
+                }
+
                 if (event.type == SDL_TEXTINPUT) {
                     HandleNameEntryTextInput(event.text.text);
                 }
@@ -111,14 +128,38 @@ int App::Run() {
             if (input_.KeyPressed(SDLK_F10)) {
                 debug_audio_overlay_ = !debug_audio_overlay_;
             }
+            if (input_.KeyPressed(SDLK_F11)) {
+                debug_lua_overlay_ = !debug_lua_overlay_;
+            }
             if (input_.KeyPressed(SDLK_F1)) {
                 debug_panel_visible_ = !debug_panel_visible_;
             }
+            if (input_.KeyPressed(SDLK_F7)) {
+                StepTimeScale(-1);
+            }
+            if (input_.KeyPressed(SDLK_F8)) {
+                StepTimeScale(1);
+            }
+            // Zoom only in play: '-' is a valid name-entry character.
+            if (sm_.Current() == snake::game::Screen::Playing || sm_.Current() == snake::game::Screen::Paused) {
+                if (input_.KeyPressed(SDLK_MINUS) || input_.KeyPressed(SDLK_KP_MINUS)) {
+                    StepZoom(-1);
+                }
+                if (input_.KeyPressed(SDLK_EQUALS) || input_.KeyPressed(SDLK_KP_PLUS)) {
+                    StepZoom(1);
+                }
+            }
+            UpdateLuaReload();
 
             HandleMenus(running);
 
             RenderFrame();
+            lua_.StepGc(kLuaGcBudgetSec);
+            frame_histogram_.Add(time_.FrameDt() * 1000.0);
+            heap_allocs_last_frame_ = HeapAllocationCount() - heap_at_frame_start;
         }
+
+        WriteLuaProfile();
     } catch (const std::exception& ex) {
         SDL_Log("App run failed: %s", ex.what());
         return 1;
@@ -201,6 +242,7 @@ void App::ShutdownSDL() {
     sfx_.Reset();
     audio_.Shutdown();
     renderer_impl_.Shutdown();
+    asset_cache_.Clear();
 
     if (renderer_ != nullptr) {
         SDL_DestroyRenderer(renderer_);
@@ -232,19 +274,28 @@ void App::RenderFrame() {
     snake::render::RenderSettings rs{};
     rs.tile_px = active_config_.Data().grid.tile_size > 0 ? active_config_.Data().grid.tile_size : 32;
     rs.panel_mode = active_config_.Data().ui.panel_mode;
+    rs.zoom = kZoomLevels[static_cast<std::size_t>(zoom_index_)];
 
-    std::string overlay_error_text = renderer_error_text_;
-    if (!config_error_text_.empty()) {
+    // Frame temporaries (error text, overlay lines, UI views) live on the frame arena and
+    // are dropped wholesale at the next reset.
+    frame_arena_.Reset();
+    std::pmr::string overlay_error_text(renderer_error_text_, &frame_arena_);
+    auto append_error = [&overlay_error_text](std::string_view text) {
         if (!overlay_error_text.empty()) {
             overlay_error_text.append(" | ");
         }
-        overlay_error_text.append(config_error_text_);
+        overlay_error_text.append(text);
+    };
+    if (!config_error_text_.empty()) {
+        append_error(config_error_text_);
     }
     if (const auto& err = lua_.LastError()) {
-        if (!overlay_error_text.empty()) {
-            overlay_error_text.append(" | ");
-        }
-        overlay_error_text.append(err->message);
+        append_error(err->message);
+    }
+
+    const Uint64 ui_build_start = SDL_GetPerformanceCounter();
+    if (sm_.Current() == snake::game::Screen::Options) {
+        RefreshOptionItems();
     }
 
     snake::render::UiFrameData ui{};
@@ -262,64 +313,77 @@ void App::RenderFrame() {
     ui.name_entry = name_entry_;
     ui.config = &pending_config_.Data();
     ui.highscores = &highscores_.Entries();
-    ui.menu_items = menu_items_;
+    ui.highscores_revision = highscores_.Revision();
+    ui.menu_items = &menu_items_;
+    ui.option_items = &option_items_;
     ui.debug_panel_visible = debug_panel_visible_;
     ui.effective_tps = last_effective_ticks_per_sec_;
-
-    auto bool_label = [](bool on) { return on ? "On" : "Off"; };
-    auto wrap_label = [](bool wrap) { return wrap ? "On" : "Off"; };
-    auto keypair_to_text = [](const snake::io::KeyPair& kp) {
-        std::string a = snake::io::Config::KeycodeToToken(kp.primary);
-        std::string b = snake::io::Config::KeycodeToToken(kp.secondary);
-        if (a.empty()) a = SDL_GetKeyName(kp.primary);
-        if (b.empty()) b = SDL_GetKeyName(kp.secondary);
-        if (a.empty()) a = "-";
-        if (b.empty()) b = "-";
-        return a + " / " + b;
-    };
-
-    ui.option_items = {
-        {"Board Width:", std::to_string(pending_config_.Data().grid.board_w)},
-        {"Board Height:", std::to_string(pending_config_.Data().grid.board_h)},
-        {"Tile Size:", std::to_string(pending_config_.Data().grid.tile_size)},
-        {"Wrap Mode:", wrap_label(pending_config_.Data().grid.wrap_mode)},
-        {"Window Width:", std::to_string(pending_config_.Data().window.width)},
-        {"Window Height:", std::to_string(pending_config_.Data().window.height)},
-        {"Fullscreen Desktop:", bool_label(pending_config_.Data().window.fullscreen_desktop)},
-        {"VSync:", bool_label(pending_config_.Data().window.vsync)},
-        {"Audio Enabled:", bool_label(pending_config_.Data().audio.enabled)},
-        {"Master Volume:", std::to_string(pending_config_.Data().audio.master_volume)},
-        {"SFX Volume:", std::to_string(pending_config_.Data().audio.sfx_volume)},
-        {"UI Panel Mode:", pending_config_.Data().ui.panel_mode},
-        {"Keybind Up:", keypair_to_text(pending_config_.Data().keys.up)},
-        {"Keybind Down:", keypair_to_text(pending_config_.Data().keys.down)},
-        {"Keybind Left:", keypair_to_text(pending_config_.Data().keys.left)},
-        {"Keybind Right:", keypair_to_text(pending_config_.Data().keys.right)},
-        {"Keybind Pause:", keypair_to_text(pending_config_.Data().keys.pause)},
-        {"Keybind Restart:", keypair_to_text(pending_config_.Data().keys.restart)},
-        {"Keybind Menu:", keypair_to_text(pending_config_.Data().keys.menu)},
-        {"Keybind Confirm:", keypair_to_text(pending_config_.Data().keys.confirm)},
-        {"Back", ""},
+    ui.time_scale = time_.TimeScale();
+    ui.achieved_tps = achieved_ticks_per_sec_;
+    ui.frame_arena = &frame_arena_;
+    ui.heap_allocs_last_frame =
+        HeapCountingEnabled() ? static_cast<long long>(heap_allocs_last_frame_) : -1;
+    ui.arena_last_frame_bytes = frame_arena_.GetStats().last_frame_bytes;
+    ui.arena_capacity_bytes = frame_arena_.GetStats().capacity_bytes;
+
+    auto add_line = [](snake::render::DebugLines& lines, std::initializer_list<std::string_view> parts) {
+        auto& line = lines.emplace_back();
+        for (const auto part : parts) {
+            line.append(part);
+        }
     };
+    char num[64];
 
     const auto& audio_diag = audio_.Diagnostics();
-    std::vector<std::string> audio_lines;
+    snake::render::DebugLines audio_lines(&frame_arena_);
     if (debug_audio_overlay_) {
         const bool audio_ok = audio_diag.device_opened && audio_.IsEnabled();
-        const std::string status = audio_ok ? "AUDIO: OK" : "AUDIO: FAIL";
-        audio_lines.push_back(status);
-        audio_lines.push_back(std::string("Device opened: ") + (audio_diag.device_opened ? "yes" : "no"));
-        audio_lines.push_back(std::string("Enabled: ") + (active_config_.Data().audio.enabled ? "yes" : "no"));
-        audio_lines.push_back("Master volume: " + std::to_string(active_config_.Data().audio.master_volume));
-        audio_lines.push_back("SFX volume: " + std::to_string(active_config_.Data().audio.sfx_volume));
-        const std::string loaded_line =
-            "Loaded sounds: " + std::to_string(sfx_.LoadedCount()) + "/" + std::to_string(sfx_.ExpectedCount()) +
-            " (fallback " + std::to_string(sfx_.FallbackCount()) + ")";
-        audio_lines.push_back(loaded_line);
-        const std::string last_error = !sfx_.LastError().empty() ? sfx_.LastError() : audio_diag.last_error;
-        audio_lines.push_back(std::string("Last error: ") + (last_error.empty() ? "None" : last_error));
-        audio_lines.push_back(std::string("Last play: ") + (sfx_.LastPlay().empty() ? "None" : sfx_.LastPlay()));
+        add_line(audio_lines, {audio_ok ? "AUDIO: OK" : "AUDIO: FAIL"});
+        add_line(audio_lines, {"Device opened: ", audio_diag.device_opened ? "yes" : "no"});
+        add_line(audio_lines, {"Enabled: ", active_config_.Data().audio.enabled ? "yes" : "no"});
+        std::snprintf(num, sizeof(num), "%d", active_config_.Data().audio.master_volume);
+        add_line(audio_lines, {"Master volume: ", num});
+        std::snprintf(num, sizeof(num), "%d", active_config_.Data().audio.sfx_volume);
+        add_line(audio_lines, {"SFX volume: ", num});
+        std::snprintf(num,
+                      sizeof(num),
+                      "%d/%d (fallback %d)",
+                      sfx_.LoadedCount(),
+                      sfx_.ExpectedCount(),
+                      sfx_.FallbackCount());
+        add_line(audio_lines, {"Loaded sounds: ", num});
+        const std::string_view last_error =
+            !sfx_.LastError().empty() ? std::string_view(sfx_.LastError()) : std::string_view(audio_diag.last_error);
+        add_line(audio_lines, {"Last error: ", last_error.empty() ? "None" : last_error});
+        add_line(audio_lines, {"Last play: ", sfx_.LastPlay().empty() ? "None" : std::string_view(sfx_.LastPlay())});
+    }
+
+    // The profiler and histogram still build their rows as std::string; only the copies
+    // handed to the renderer live on the arena. The F11 overlay is not a steady-state path.
+    snake::render::DebugLines lua_lines(&frame_arena_);
+    if (debug_lua_overlay_) {
+        for (const auto& line : lua_.Profiler().OverlayLines(kLuaOverlayRows)) {
+            add_line(lua_lines, {line});
+        }
+        if (lua_.InstructionBudget() > 0) {
+            std::snprintf(num,
+                          sizeof(num),
+                          "Lua heap: %zu KB, budget: %d instr",
+                          lua_.HeapBytes() / 1024,
+                          lua_.InstructionBudget());
+        } else {
+            std::snprintf(num,
+                          sizeof(num),
+                          "Lua heap: %zu KB, budget: off",
+                          lua_.HeapBytes() / 1024);
+        }
+        add_line(lua_lines, {num});
+        for (const auto& line : frame_histogram_.Lines("Frame time")) {
+            add_line(lua_lines, {line});
+        }
     }
+    ui.build_ms = static_cast<double>(SDL_GetPerformanceCounter() - ui_build_start) * 1000.0 /
+                  static_cast<double>(SDL_GetPerformanceFrequency());
 
     renderer_impl_.RenderFrame(renderer_,
                                window_w,
@@ -331,9 +395,56 @@ void App::RenderFrame() {
                                debug_text_overlay_,
                                debug_audio_overlay_,
                                audio_lines,
+                               debug_lua_overlay_,
+                               lua_lines,
                                ui);
 }
 
+void App::RefreshOptionItems() {
+    const auto& d = pending_config_.Data();
+    if (option_items_valid_ && option_items_revision_ == pending_config_revision_) {
+        return;
+    }
+
+    auto bool_label = [](bool on) { return on ? "On" : "Off"; };
+    auto wrap_label = [](bool wrap) { return wrap ? "On" : "Off"; };
+    auto keypair_to_text = [](const snake::io::KeyPair& kp) {
+        std::string a = snake::io::Config::KeycodeToToken(kp.primary);
+        std::string b = snake::io::Config::KeycodeToToken(kp.secondary);
+        if (a.empty()) a = SDL_GetKeyName(kp.primary);
+        if (b.empty()) b = SDL_GetKeyName(kp.secondary);
+        if (a.empty()) a = "-";
+        if (b.empty()) b = "-";
+        return a + " / " + b;
+    };
+
+    option_items_ = {
+        {"Board Width:", std::to_string(d.grid.board_w)},
+        {"Board Height:", std::to_string(d.grid.board_h)},
+        {"Tile Size:", std::to_string(d.grid.tile_size)},
+        {"Wrap Mode:", wrap_label(d.grid.wrap_mode)},
+        {"Window Width:", std::to_string(d.window.width)},
+        {"Window Height:", std::to_string(d.window.height)},
+        {"Fullscreen Desktop:", bool_label(d.window.fullscreen_desktop)},
+        {"VSync:", bool_label(d.window.vsync)},
+        {"Audio Enabled:", bool_label(d.audio.enabled)},
+        {"Master Volume:", std::to_string(d.audio.master_volume)},
+        {"SFX Volume:", std::to_string(d.audio.sfx_volume)},
+        {"UI Panel Mode:", d.ui.panel_mode},
+        {"Keybind Up:", keypair_to_text(d.keys.up)},
+        {"Keybind Down:", keypair_to_text(d.keys.down)},
+        {"Keybind Left:", keypair_to_text(d.keys.left)},
+        {"Keybind Right:", keypair_to_text(d.keys.right)},
+        {"Keybind Pause:", keypair_to_text(d.keys.pause)},
+        {"Keybind Restart:", keypair_to_text(d.keys.restart)},
+        {"Keybind Menu:", keypair_to_text(d.keys.menu)},
+        {"Keybind Confirm:", keypair_to_text(d.keys.confirm)},
+        {"Back", ""},
+    };
+    option_items_revision_ = pending_config_revision_;
+    option_items_valid_ = true;
+}
+
 bool App::RecreateRenderer(bool want_vsync) {
     if (renderer_ == nullptr || window_ == nullptr) {
         SDL_Log("RecreateRenderer called before window/renderer were initialized");
@@ -345,6 +456,10 @@ bool App::RecreateRenderer(bool want_vsync) {
         return true;
     }
 
+    // The whole call is a visible hitch (the frame it runs in is late), so log how long it takes.
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const std::uint64_t disk_loads_before = asset_cache_.GetStats().disk_loads;
+
     Uint32 flags = SDL_RENDERER_ACCELERATED;
     if (want_vsync) {
         flags |= SDL_RENDERER_PRESENTVSYNC;
@@ -360,9 +475,9 @@ bool App::RecreateRenderer(bool want_vsync) {
 
     renderer_impl_.Shutdown();
 
-    if (!renderer_impl_.Init(new_renderer)) {
+    if (!renderer_impl_.Init(new_renderer, &asset_cache_)) {
         SDL_Log("Failed to initialize render resources after recreating SDL_Renderer");
-        if (!renderer_impl_.Init(renderer_)) {
+        if (!renderer_impl_.Init(renderer_, &asset_cache_)) {
             SDL_Log("Failed to restore render resources on previous renderer");
         }
         SDL_DestroyRenderer(new_renderer);
@@ -379,6 +494,12 @@ bool App::RecreateRenderer(bool want_vsync) {
         SDL_DestroyRenderer(old_renderer);
     }
 
+    const double hitch_ms = static_cast<double>(SDL_GetPerformanceCounter() - start) * 1000.0 /
+                            static_cast<double>(SDL_GetPerformanceFrequency());
+    SDL_Log("Renderer recreated (VSync %s) in %.2f ms, %llu asset file loads",
+            want_vsync ? "on" : "off",
+            hitch_ms,
+            static_cast<unsigned long long>(asset_cache_.GetStats().disk_loads - disk_loads_before));
     return true;
 }
 
@@ -386,29 +507,156 @@ void App::ApplyConfig() {
     const auto& data = active_config_.Data();
     game_.SetBoardSize(data.grid.board_w, data.grid.board_h);
     game_.SetWrapMode(data.grid.wrap_mode);
+    ApplyGameplaySettings();
+    ApplyControlSettings();
+}
+
+void App::ApplyGameplaySettings() {
+    const auto& data = active_config_.Data();
     game_.SetFoodScore(data.gameplay.food_score);
     const int bonus_score = data.gameplay.bonus_score_score > 0 ? data.gameplay.bonus_score_score : data.gameplay.bonus_score;
     game_.SetBonusScore(bonus_score);
     game_.SetSlowParams(data.gameplay.slow_multiplier, data.gameplay.slow_duration_sec);
+    lua_.SetInstructionBudget(data.lua.instruction_budget);
+}
+
+// A hot reload re-ran config.lua (possibly edited by hand): take its values as the new settings,
+// so the next Options save writes them back instead of the stale ones. Board size and wrap mode
+// wait for the next round, as they do when changed from the Options screen.
+void App::AdoptReloadedConfig(const snake::io::ConfigData& loaded) {
+    const snake::io::ConfigData previous_active = active_config_.Data();
+    pending_config_.Data() = loaded;
+    pending_config_.Sanitize();
+    ++pending_config_revision_;
 
+    SyncActiveWithPendingPreserveRound();
+    ApplyImmediateSettings(previous_active, active_config_.Data());
+    ApplyGameplaySettings();
+    ApplyAudioSettings();
     ApplyControlSettings();
 }
 
 void App::InitLua() {
-    if (!lua_.Init()) {
+    const Uint64 start = SDL_GetPerformanceCounter();
+    if (!lua_.Init(/*manual_gc=*/true)) {
         SDL_Log("Failed to init Lua runtime");
         return;
     }
 
     snake::lua::Bindings::Register(lua_.L());
+    lua_.SetGame(&game_);
 
     const auto rules_path = snake::io::AssetsPath("scripts/rules.lua");
     const auto config_path = config_path_.empty() ? snake::io::UserPath("config.lua") : config_path_;
-    if (!lua_.LoadRules(rules_path)) {
-        SDL_Log("Failed to load Lua rules");
+    const bool scripts_ok = lua_.LoadScripts(config_path, rules_path, &pending_config_, [this]() {
+        // A native rule module replaces rules.lua; if it fails to load, fall back to Lua.
+        const std::string& plugin = pending_config_.Data().rules.plugin;
+        if (!plugin.empty()) {
+            std::string error;
+            if (rules_plugin_.Load(plugin, &error)) {
+                SDL_Log("Rules plugin loaded: %s (%s)", rules_plugin_.Name().c_str(), plugin.c_str());
+            } else {
+                SDL_Log("Failed to load rules plugin %s: %s; using rules.lua", plugin.c_str(), error.c_str());
+            }
+        }
+        return !rules_plugin_.IsLoaded();
+    });
+    if (!scripts_ok) {
+        const auto& err = lua_.LastError();
+        SDL_Log("Failed to load Lua scripts: %s", err ? err->message.c_str() : "unknown error");
     }
-    if (!lua_.LoadConfig(config_path)) {
-        SDL_Log("Failed to load Lua config");
+    game_.SetBonusSpawnWeights(rules_plugin_.IsLoaded() ? rules_plugin_.BonusSpawnWeights()
+                                                        : lua_.BonusSpawnWeights());
+    SDL_Log("Lua startup: %.2f ms",
+            static_cast<double>(SDL_GetPerformanceCounter() - start) * 1000.0 /
+                static_cast<double>(SDL_GetPerformanceFrequency()));
+
+    lua_watcher_.Start({snake::io::AssetsPath("scripts"), config_path});
+}
+
+void App::CallRulesHook(snake::lua::Hook hook) {
+    if (!rules_plugin_.IsLoaded()) {
+        lua_.CallHook(hook);
+        return;
+    }
+    switch (hook) {
+        case snake::lua::Hook::AppInit: rules_plugin_.OnAppInit(game_); break;
+        case snake::lua::Hook::RoundStart: rules_plugin_.OnRoundStart(game_); break;
+        case snake::lua::Hook::TickBegin: rules_plugin_.OnTickBegin(game_); break;
+        case snake::lua::Hook::TickEnd: rules_plugin_.OnTickEnd(game_); break;
+        case snake::lua::Hook::FoodEaten: rules_plugin_.OnFoodEaten(game_); break;
+        default: break;
+    }
+}
+
+void App::CallRulesHook(snake::lua::Hook hook, const std::string& arg) {
+    if (!rules_plugin_.IsLoaded()) {
+        lua_.CallHook(hook, arg);
+        return;
+    }
+    switch (hook) {
+        case snake::lua::Hook::BonusPicked: rules_plugin_.OnBonusPicked(game_, arg); break;
+        case snake::lua::Hook::GameOver: rules_plugin_.OnGameOver(game_, arg); break;
+        case snake::lua::Hook::SettingChanged: rules_plugin_.OnSettingChanged(game_, arg); break;
+        default: break;
+    }
+}
+
+void App::UpdateLuaReload() {
+    const bool f5 = input_.KeyPressed(SDLK_F5);
+    const bool changed = lua_watcher_.ConsumeChange();
+    if (rules_plugin_.IsLoaded()) {
+        if (f5) {
+            PushUiMessage("Rules plugin active: restart to reload");
+        }
+        return;
+    }
+    if (f5 || changed) {
+        lua_reload_requested_ = true;
+    }
+
+    switch (lua_.PollHotReload()) {
+        case snake::lua::ReloadStatus::Applied:
+            lua_reload_error_.clear();
+            if (const auto reloaded = lua_.TakeReloadedConfig()) {
+                AdoptReloadedConfig(reloaded->Data());
+            }
+            game_.SetBonusSpawnWeights(lua_.BonusSpawnWeights());
+            PushUiMessage("Lua rules reloaded");
+            UpdateTickRate();
+            break;
+        case snake::lua::ReloadStatus::Failed:
+            if (const auto& err = lua_.LastError()) {
+                lua_reload_error_ = "reload error: " + err->message;
+            }
+            break;
+        default:
+            break;
+    }
+
+    // One reload at a time; a change that lands mid-reload is picked up right after.
+    if (lua_reload_requested_ && lua_.IsReady() && !lua_.HotReloadPending()) {
+        lua_reload_requested_ = false;
+        const auto config_path = config_path_.empty() ? snake::io::UserPath("config.lua") : config_path_;
+        lua_.BeginHotReload(snake::io::AssetsPath("scripts/rules.lua"), config_path);
+    }
+}
+
+void App::WriteLuaProfile() {
+    if (lua_.Profiler().Empty()) {
+        return;
+    }
+    const auto path = snake::io::UserPath("lua_profile.txt");
+    std::ofstream out(path, std::ios::trunc);
+    lua_.Profiler().WriteReport(out);
+    out << '\n';
+    for (const auto& line : frame_histogram_.Lines("Frame time")) {
+        out << line << '\n';
+    }
+    if (out) {
+        SDL_Log("Lua profile written to %s", path.string().c_str());
+    } else {
+        SDL_Log("Failed to write Lua profile to %s", path.string().c_str());
     }
 }
 
@@ -425,9 +673,10 @@ void App::HandleMenus(bool& running) {
         ApplyRoundSettingsOnRestart();
         ApplyConfig();
         game_.ResetAll();
+        round_tick_ = 0;
         renderer_impl_.ResetEffects();
         sm_.StartGame();
-        lua_.CallWithCtxIfExists("on_round_start", &lua_ctx_);
+        CallRulesHook(snake::lua::Hook::RoundStart);
     };
 
     if (rebinding_) {
@@ -553,64 +802,79 @@ void App::HandleMenus(bool& running) {
 
     if (sm_.Is(snake::game::Screen::Playing)) {
         time_.UpdateFrame();
-
-        // Compute speed from Lua
-        const int score = game_.GetScore().Score();
-        double base_tps = last_base_ticks_per_sec_;
-        if (lua_.IsReady()) {
-            double lua_tps = 0.0;
-            if (lua_.GetBaseTicksPerSec(score, &lua_tps)) {
-                base_tps = lua_tps;
-                last_base_ticks_per_sec_ = lua_tps;
+        UpdateTickRate();
+
+        // Per-tick simulation (Game::Tick + Lua hooks) runs in full; render effects,
+        // sounds and logs are collapsed into one summary per frame so fast-forward
+        // doesn't flood the renderer with thousands of effects.
+        FrameTickSummary summary;
+        const bool fast_forward = time_.TimeScale() > 1.0;
+        const double budget_end = time_.Now() + kTickBudgetSec;
+        int ticks_done = 0;
+        while (time_.HasPendingTick()) {
+            if (!fast_forward && ticks_done >= kMaxTicksPerFrame) {
+                break;
             }
-        }
+            if (fast_forward && (ticks_done % kBudgetCheckInterval) == 0 && time_.Now() >= budget_end) {
+                break;
+            }
+            time_.ConsumeTick();
+            ++round_tick_;
+            lua_.QueueTick(round_tick_);
 
-        const bool slow_active = game_.GetEffects().SlowActive();
-        const double slow_multiplier =
-            slow_active ? game_.GetEffects().SlowMultiplier() : 1.0;
-        const double effective_tps = base_tps * slow_multiplier;
-        const double tick_dt = effective_tps > 0.0 ? 1.0 / effective_tps : 0.1;
-        time_.SetTickDt(tick_dt);
-        last_effective_ticks_per_sec_ = effective_tps;
-
-        int ticks_done = 0;
-        while (time_.ConsumeTick() && ticks_done < kMaxTicksPerFrame) {
-            lua_.CallWithCtxIfExists("on_tick_begin", &lua_ctx_);
+            CallRulesHook(snake::lua::Hook::TickBegin);
 
+            const bool slow_before = game_.GetEffects().SlowActive();
             game_.Tick(time_.TickDt());
-            const auto events = game_.Events();
+            const auto& events = game_.Events();
 
             if (events.food_eaten) {
-                renderer_impl_.SpawnFoodEat(game_.GetSnake().Head(), game_.FoodScore());
-                lua_.CallWithCtxIfExists("on_food_eaten", &lua_ctx_);
-                SDL_Log("Audio event: food_eaten");
-                sfx_.Play(snake::audio::SfxId::Eat, "food_eaten");
+                ++summary.food_eaten;
+                summary.food_score += game_.FoodScore();
+                summary.food_pos = game_.GetSnake().Head();
+                CallRulesHook(snake::lua::Hook::FoodEaten);
+                lua_.QueueEvent(snake::lua::GameEvent::FoodEaten, round_tick_);
             }
             if (events.bonus_picked) {
-                const int bonus_delta = events.bonus_type == "bonus_score" ? game_.BonusScore() : 0;
-                renderer_impl_.SpawnBonusPickup(game_.GetSnake().Head(), events.bonus_type, bonus_delta);
-                lua_.CallWithCtxIfExists("on_bonus_picked", &lua_ctx_, events.bonus_type);
-                SDL_Log("Audio event: bonus_picked (%s)", events.bonus_type.c_str());
-                sfx_.Play(snake::audio::SfxId::Eat, "bonus_picked");
+                if (events.bonus_type == "bonus_score") {
+                    ++summary.bonus_score_picked;
+                    summary.bonus_score_delta += game_.BonusScore();
+                    summary.bonus_score_pos = game_.GetSnake().Head();
+                } else {
+                    ++summary.bonus_slow_picked;
+                    summary.bonus_slow_pos = game_.GetSnake().Head();
+                }
+                CallRulesHook(snake::lua::Hook::BonusPicked, events.bonus_type);
+                lua_.QueueEvent(snake::lua::GameEvent::BonusPicked, round_tick_, events.bonus_type);
             }
             if (!game_.IsGameOver()) {
-                lua_.CallWithCtxIfExists("on_tick_end", &lua_ctx_);
+                CallRulesHook(snake::lua::Hook::TickEnd);
             }
 
             ++ticks_done;
+            if (game_.IsGameOver()) {
+                break;
+            }
+            if (events.food_eaten || events.bonus_picked || slow_before != game_.GetEffects().SlowActive()) {
+                UpdateTickRate();
+            }
         }
 
-        if (ticks_done >= kMaxTicksPerFrame) {
+        if (time_.HasPendingTick() && !game_.IsGameOver()) {
             time_.DropAccumulatorToOneTick();
         }
 
+        lua_.FlushEvents();
+        ApplyFrameTickSummary(summary);
+        MeasureAchievedTickRate(ticks_done);
+
         if (game_.IsGameOver()) {
             sm_.GameOver();
             const int score = game_.GetScore().Score();
             if (highscores_.Qualifies(score)) {
                 EnterNameEntry(score);
             }
-            lua_.CallWithCtxIfExists("on_game_over", &lua_ctx_, game_.GameOverReason());
+            CallRulesHook(snake::lua::Hook::GameOver, std::string(game_.GameOverReason()));
             SDL_Log("Audio event: game_over (%s)", std::string(game_.GameOverReason()).c_str());
             sfx_.Play(snake::audio::SfxId::GameOver, "game_over");
         }
@@ -619,6 +883,88 @@ void App::HandleMenus(bool& running) {
     }
 }
 
+void App::UpdateTickRate() {
+    // Compute speed from the rules (native plugin or Lua)
+    const int score = game_.GetScore().Score();
+    double base_tps = last_base_ticks_per_sec_;
+    double plugin_tps = 0.0;
+    if (rules_plugin_.IsLoaded()) {
+        if (rules_plugin_.GetBaseTicksPerSec(score, &plugin_tps)) {
+            base_tps = plugin_tps;
+            last_base_ticks_per_sec_ = plugin_tps;
+        }
+    } else if (lua_.IsReady()) {
+        double lua_tps = 0.0;
+        if (lua_.GetBaseTicksPerSec(score, &lua_tps)) {
+            base_tps = lua_tps;
+            last_base_ticks_per_sec_ = lua_tps;
+        }
+    }
+
+    const bool slow_active = game_.GetEffects().SlowActive();
+    const double slow_multiplier =
+        slow_active ? game_.GetEffects().SlowMultiplier() : 1.0;
+    const double effective_tps = base_tps * slow_multiplier;
+    const double tick_dt = effective_tps > 0.0 ? 1.0 / effective_tps : 0.1;
+    time_.SetTickDt(tick_dt);
+    last_effective_ticks_per_sec_ = effective_tps;
+}
+
+void App::ApplyFrameTickSummary(const FrameTickSummary& summary) {
+    if (summary.food_eaten > 0) {
+        renderer_impl_.SpawnFoodEat(summary.food_pos, summary.food_score);
+        if (summary.food_eaten > 1) {
+            SDL_Log("Audio event: food_eaten (x%d)", summary.food_eaten);
+        } else {
+            SDL_Log("Audio event: food_eaten");
+        }
+        sfx_.Play(snake::audio::SfxId::Eat, "food_eaten");
+    }
+    if (summary.bonus_score_picked > 0) {
+        renderer_impl_.SpawnBonusPickup(summary.bonus_score_pos, "bonus_score", summary.bonus_score_delta);
+    }
+    if (summary.bonus_slow_picked > 0) {
+        renderer_impl_.SpawnBonusPickup(summary.bonus_slow_pos, "bonus_slow", 0);
+    }
+    const int bonus_picked = summary.bonus_score_picked + summary.bonus_slow_picked;
+    if (bonus_picked > 0) {
+        SDL_Log("Audio event: bonus_picked (score x%d, slow x%d)",
+                summary.bonus_score_picked,
+                summary.bonus_slow_picked);
+        sfx_.Play(snake::audio::SfxId::Eat, "bonus_picked");
+    }
+}
+
+void App::MeasureAchievedTickRate(int ticks_done) {
+    const double now = time_.Now();
+    if (tps_window_start_ <= 0.0) {
+        tps_window_start_ = now;
+    }
+    tps_window_ticks_ += ticks_done;
+    const double elapsed = now - tps_window_start_;
+    if (elapsed >= kAchievedTpsWindowSec) {
+        achieved_ticks_per_sec_ = static_cast<double>(tps_window_ticks_) / elapsed;
+        tps_window_ticks_ = 0;
+        tps_window_start_ = now;
+    }
+}
+
+void App::StepTimeScale(int direction) {
+    const int count = static_cast<int>(kTimeScales.size());
+    time_scale_index_ = std::clamp(time_scale_index_ + direction, 0, count - 1);
+    time_.SetTimeScale(kTimeScales[static_cast<std::size_t>(time_scale_index_)]);
+    tps_window_ticks_ = 0;
+    tps_window_start_ = 0.0;
+    achieved_ticks_per_sec_ = 0.0;
+    SDL_Log("Time scale: %.0fx", time_.TimeScale());
+}
+
+void App::StepZoom(int direction) {
+    const int count = static_cast<int>(kZoomLevels.size());
+    zoom_index_ = std::clamp(zoom_index_ + direction, 0, count - 1);
+    SDL_Log("Board zoom: %.2fx", kZoomLevels[static_cast<std::size_t>(zoom_index_)]);
+}
+
 void App::HandleNameEntryInput() {
     const bool backspace_pressed = input_.KeyPressed(SDLK_BACKSPACE);
     const bool enter_pressed = input_.KeyPressed(SDLK_RETURN) || input_.KeyPressed(SDLK_KP_ENTER);
@@ -1070,19 +1416,14 @@ void App::ApplyControlSettings() {
 }
 
 void App::NotifySettingChanged(const std::string& key) {
-    if (!lua_.IsReady()) {
-        return;
-    }
-    lua_State* L = lua_.L();
-    if (L == nullptr) {
+    if (rules_plugin_.IsLoaded()) {
+        rules_plugin_.OnSettingChanged(game_, key);
         return;
     }
-    lua_getglobal(L, "on_setting_changed");
-    if (!lua_isfunction(L, -1)) {
-        lua_pop(L, 1);
+    if (!lua_.PushHook(snake::lua::Hook::SettingChanged)) {
         return;
     }
-    lua_pushlightuserdata(L, &lua_ctx_);
+    lua_State* L = lua_.L();
     lua_pushlstring(L, key.data(), key.size());
 
     const auto& d = pending_config_.Data();
@@ -1135,11 +1476,7 @@ void App::NotifySettingChanged(const std::string& key) {
         lua_pushnil(L);
     }
 
-    if (lua_pcall(L, 3, 0, 0) != LUA_OK) {
-        const char* err = lua_tostring(L, -1);
-        SDL_Log("on_setting_changed failed: %s", err ? err : "unknown error");
-        lua_pop(L, 1);
-    }
+    lua_.CallPushedHook(snake::lua::Hook::SettingChanged, 3);
 }
 
 bool App::CommitConfigChange(
@@ -1154,6 +1491,9 @@ bool App::CommitConfigChange(
     if (mutate) {
         changed = mutate(pending_config_.Data());
     }
+    // Every path below leaves pending_config_ changed or restored; either way it is rewritten
+    // only here, so this is the one place its revision moves.
+    ++pending_config_revision_;
     if (!changed) {
         pending_config_.Data() = previous_pending;
         pending_config_.Sanitize();
@@ -1170,6 +1510,8 @@ bool App::CommitConfigChange(
         RefreshPendingRoundRestartFlag();
         return false;
     }
+    // Our own save must not look like a hand edit to the Lua hot-reload watcher.
+    lua_watcher_.IgnoreOwnWrite(config_path_);
 
     config_error_text_.clear();
 
@@ -1186,7 +1528,9 @@ bool App::CommitConfigChange(
     if (!apply_ok) {
         pending_config_.Data() = previous_pending;
         pending_config_.Sanitize();
-        if (!pending_config_.SaveToFile(config_path_)) {
+        if (pending_config_.SaveToFile(config_path_)) {
+            lua_watcher_.IgnoreOwnWrite(config_path_);
+        } else {
             SDL_Log("Failed to save config after revert to %s", config_path_.string().c_str());
             config_error_text_ = "Failed to save config.lua";
         }
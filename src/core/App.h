@@ -2,29 +2,30 @@
 
 #include <SDL.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <filesystem>
 #include <functional>
 
+#include "core/FrameArena.h"
+#include "core/FrameHistogram.h"
 #include "core/Input.h"
 #include "core/Time.h"
 #include "audio/AudioSystem.h"
 #include "audio/SFX.h"
 #include "game/Game.h"
+#include "game/RulesPlugin.h"
 #include "game/StateMachine.h"
 #include "lua/LuaRuntime.h"
 #include "io/Config.h"
+#include "io/FileWatcher.h"
 #include "io/Highscores.h"
+#include "render/AssetCache.h"
 #include "render/Renderer.h"
 
 namespace snake::core {
 
-struct AppLuaContext {
-    snake::game::Game* game = nullptr;
-    snake::audio::AudioSystem* audio = nullptr;
-};
-
 class App {
 public:
     App();
@@ -43,9 +44,28 @@ private:
     void CreateWindowAndRenderer(bool want_vsync);
     void ShutdownSDL();
     void RenderFrame();
+    void RefreshOptionItems();
     void ApplyConfig();
+    void ApplyGameplaySettings();
+    void AdoptReloadedConfig(const snake::io::ConfigData& loaded);
     void InitLua();
     void HandleMenus(bool& running);
+
+    struct FrameTickSummary {
+        int food_eaten = 0;
+        int food_score = 0;
+        snake::game::Pos food_pos{};
+        int bonus_score_picked = 0;
+        int bonus_score_delta = 0;
+        snake::game::Pos bonus_score_pos{};
+        int bonus_slow_picked = 0;
+        snake::game::Pos bonus_slow_pos{};
+    };
+    void UpdateTickRate();
+    void ApplyFrameTickSummary(const FrameTickSummary& summary);
+    void MeasureAchievedTickRate(int ticks_done);
+    void StepTimeScale(int direction);
+    void StepZoom(int direction);
     void HandleOptionsInput();
     void HandleNameEntryInput();
     void HandleNameEntryTextInput(const char* text);
@@ -57,6 +77,11 @@ private:
     void BeginRebind(const std::string& action, int slot);
     void HandleRebind();
     void PushUiMessage(std::string msg);
+    // Rule hooks go to the native plugin when one is loaded, otherwise to rules.lua.
+    void CallRulesHook(snake::lua::Hook hook);
+    void CallRulesHook(snake::lua::Hook hook, const std::string& arg);
+    void UpdateLuaReload();
+    void WriteLuaProfile();
     bool ApplyImmediateSettings(const snake::io::ConfigData& previous,
                                 const snake::io::ConfigData& current);
     void ApplyRoundSettingsOnRestart();
@@ -85,12 +110,16 @@ private:
     snake::game::Game game_;
     snake::audio::AudioSystem audio_;
     snake::lua::LuaRuntime lua_;
+    snake::game::RulesPlugin rules_plugin_;
     snake::game::StateMachine sm_;
     snake::io::Config pending_config_;
     snake::io::Config active_config_;
     snake::io::Highscores highscores_;
     std::string ui_message_;
     std::string lua_reload_error_;
+    snake::io::FileWatcher lua_watcher_;
+    bool lua_reload_requested_ = false;
+    std::int64_t round_tick_ = 0;  // ticks simulated this round; tick index for on_events
     bool pending_round_restart_ = false;
     bool rebinding_ = false;
     std::string rebind_action_;
@@ -98,6 +127,13 @@ private:
     int menu_index_ = 0;
     int options_index_ = 0;
     std::vector<std::string> menu_items_;
+    // Bumped by CommitConfigChange and AdoptReloadedConfig, the only places pending_config_
+    // changes after startup.
+    std::uint64_t pending_config_revision_ = 0;
+    // Options screen rows; rebuilt only when pending_config_revision_ moves.
+    std::vector<std::pair<std::string, std::string>> option_items_;
+    std::uint64_t option_items_revision_ = 0;
+    bool option_items_valid_ = false;
     std::filesystem::path config_path_;
     std::string name_entry_;
     int pending_highscore_score_ = 0;
@@ -106,11 +142,21 @@ private:
     bool debug_panel_visible_ = false;
     bool debug_text_overlay_ = false;
     bool debug_audio_overlay_ = false;
+    bool debug_lua_overlay_ = false;
+    FrameHistogram frame_histogram_;
+    FrameArena frame_arena_;  // declared before renderer_impl_, which may hold a pointer to it
+    // Decoded sprites and fonts reused across renderer recreation; emptied in ShutdownSDL.
+    snake::render::AssetCache asset_cache_;
+    std::uint64_t heap_allocs_last_frame_ = 0;
 
     snake::render::Renderer renderer_impl_;
-    AppLuaContext lua_ctx_{};
     double last_base_ticks_per_sec_ = 10.0;
     double last_effective_ticks_per_sec_ = 10.0;
+    int time_scale_index_ = 0;
+    int zoom_index_ = 2;  // kZoomLevels index; 1x
+    double achieved_ticks_per_sec_ = 0.0;
+    int tps_window_ticks_ = 0;
+    double tps_window_start_ = 0.0;
     std::string renderer_error_text_;
     std::string config_error_text_;
 
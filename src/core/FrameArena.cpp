@@ -0,0 +1,49 @@
+#include "core/FrameArena.h"
+
+#include <algorithm>
+
+namespace snake::core {
+
+FrameArena::FrameArena(std::size_t initial_bytes) {
+    stats_.capacity_bytes = std::max<std::size_t>(initial_bytes, 1024);
+    buffer_ = std::make_unique<std::byte[]>(stats_.capacity_bytes);
+    mono_.emplace(buffer_.get(), stats_.capacity_bytes, std::pmr::new_delete_resource());
+}
+
+void FrameArena::Reset() {
+    stats_.last_frame_bytes = used_bytes_;
+    if (used_bytes_ > stats_.capacity_bytes) {
+        ++stats_.spills;
+        // Grow once with headroom; releasing the monotonic resource frees the spilled blocks.
+        std::size_t capacity = stats_.capacity_bytes;
+        while (capacity < used_bytes_ * 2) {
+            capacity *= 2;
+        }
+        mono_.reset();
+        buffer_ = std::make_unique<std::byte[]>(capacity);
+        stats_.capacity_bytes = capacity;
+        mono_.emplace(buffer_.get(), capacity, std::pmr::new_delete_resource());
+    } else {
+        mono_->release();
+    }
+    used_bytes_ = 0;
+}
+
+const FrameArena::Stats& FrameArena::GetStats() const {
+    return stats_;
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    used_bytes_ = (used_bytes_ + alignment - 1) / alignment * alignment + bytes;
+    return mono_->allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    // Memory is reclaimed by Reset().
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+}  // namespace snake::core
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace snake::core {
+
+// Bump allocator for data that lives at most one frame (error text, debug lines, C strings
+// handed to SDL_ttf). Reset() at the start of a frame reclaims all of the previous frame's
+// memory at once; deallocate is a no-op. A frame that outgrows the buffer spills to the heap
+// and the buffer is enlarged at the next Reset, so steady frames never reach the heap.
+class FrameArena final : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        std::size_t last_frame_bytes = 0;  // bytes handed out during the previous frame
+        std::size_t capacity_bytes = 0;
+        std::uint64_t spills = 0;          // frames that needed heap memory beyond the buffer
+    };
+
+    explicit FrameArena(std::size_t initial_bytes = 64 * 1024);
+
+    void Reset();
+    const Stats& GetStats() const;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    std::unique_ptr<std::byte[]> buffer_;
+    std::optional<std::pmr::monotonic_buffer_resource> mono_;
+    std::size_t used_bytes_ = 0;  // bump position estimate (includes alignment padding)
+    Stats stats_;
+};
+
+}  // namespace snake::core
@@ -0,0 +1,65 @@
+#include "core/FrameHistogram.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace snake::core {
+
+void FrameHistogram::Add(double ms) {
+    std::size_t bucket = 0;
+    while (bucket < kEdgesMs.size() && ms >= kEdgesMs[bucket]) {
+        ++bucket;
+    }
+    ++buckets_[bucket];
+    ++count_;
+    total_ms_ += ms;
+    max_ms_ = std::max(max_ms_, ms);
+}
+
+void FrameHistogram::Reset() {
+    buckets_.fill(0);
+    count_ = 0;
+    total_ms_ = 0.0;
+    max_ms_ = 0.0;
+}
+
+std::uint64_t FrameHistogram::Count() const {
+    return count_;
+}
+
+double FrameHistogram::MaxMs() const {
+    return max_ms_;
+}
+
+std::vector<std::string> FrameHistogram::Lines(const char* title) const {
+    std::vector<std::string> lines;
+    char buf[128];
+    std::snprintf(buf,
+                  sizeof(buf),
+                  "%s: n=%llu avg %.2f ms, max %.2f ms",
+                  title,
+                  static_cast<unsigned long long>(count_),
+                  count_ > 0 ? total_ms_ / static_cast<double>(count_) : 0.0,
+                  max_ms_);
+    lines.emplace_back(buf);
+
+    // Two buckets per line keeps the overlay narrow.
+    std::string line;
+    for (std::size_t i = 0; i < buckets_.size(); ++i) {
+        if (i < kEdgesMs.size()) {
+            std::snprintf(buf, sizeof(buf), "  <%5.1f ms: %8llu", kEdgesMs[i],
+                          static_cast<unsigned long long>(buckets_[i]));
+        } else {
+            std::snprintf(buf, sizeof(buf), "  >=%4.0f ms: %8llu", kEdgesMs.back(),
+                          static_cast<unsigned long long>(buckets_[i]));
+        }
+        line += buf;
+        if (i % 2 == 1 || i + 1 == buckets_.size()) {
+            lines.push_back(line);
+            line.clear();
+        }
+    }
+    return lines;
+}
+
+}  // namespace snake::core
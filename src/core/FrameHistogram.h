@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace snake::core {
+
+// Fixed-bucket histogram of frame times, for spotting periodic spikes (GC, reloads...).
+class FrameHistogram {
+public:
+    void Add(double ms);
+    void Reset();
+
+    std::uint64_t Count() const;
+    double MaxMs() const;
+    // Summary line plus bucket lines, e.g. for the debug overlay or a report file.
+    std::vector<std::string> Lines(const char* title) const;
+
+private:
+    static constexpr std::array<double, 9> kEdgesMs{4.0, 8.0, 12.0, 16.7, 20.0, 25.0, 33.4, 50.0, 100.0};
+
+    std::array<std::uint64_t, kEdgesMs.size() + 1> buckets_{};
+    std::uint64_t count_ = 0;
+    double total_ms_ = 0.0;
+    double max_ms_ = 0.0;
+};
+
+}  // namespace snake::core
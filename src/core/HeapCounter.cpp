@@ -0,0 +1,92 @@
+#include "core/HeapCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+namespace snake::core {
+namespace {
+std::atomic<std::uint64_t> g_heap_allocations{0};
+}  // namespace
+
+bool HeapCountingEnabled() {
+#if defined(SNAKE_COUNT_HEAP_ALLOCS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t HeapAllocationCount() {
+    return g_heap_allocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace snake::core
+
+#if defined(SNAKE_COUNT_HEAP_ALLOCS)
+// Replacement global allocation functions. The default array and nothrow forms are specified
+// to forward to these, so only the plain and over-aligned families are replaced (std::pmr's
+// new_delete_resource allocates with the aligned form).
+namespace {
+
+void* CountedAlloc(std::size_t size, std::size_t alignment) {
+    snake::core::g_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    for (;;) {
+        void* p = nullptr;
+        if (alignment == 0) {
+            p = std::malloc(size);
+        } else {
+#if defined(_MSC_VER)
+            p = _aligned_malloc(size, alignment);
+#else
+            p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+        }
+        if (p != nullptr) {
+            return p;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    return CountedAlloc(size, 0);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept {
+    std::free(p);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return CountedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p, std::align_val_t /*alignment*/) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void operator delete(void* p, std::size_t /*size*/, std::align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+#endif
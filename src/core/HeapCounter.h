@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace snake::core {
+
+// Number of global operator new calls since start-up, for checking that a frame does not
+// allocate. Only counted when the build replaces the global allocation functions
+// (SNAKE_COUNT_HEAP_ALLOCS); otherwise HeapCountingEnabled() is false and the count stays 0.
+// malloc calls made by SDL, Lua or other C code are not seen.
+bool HeapCountingEnabled();
+std::uint64_t HeapAllocationCount();
+
+}  // namespace snake::core
@@ -28,7 +28,7 @@ void Time::UpdateFrame() {
         frame_dt_ = kMaxFrameDt;
     }
 
-    accumulator_ += frame_dt_;
+    accumulator_ += frame_dt_ * time_scale_;
 }
 
 void Time::UpdateFrameNoAccum() {
@@ -89,4 +89,19 @@ void Time::DropAccumulatorToOneTick() {
     }
 }
 
+void Time::SetTimeScale(double scale) {
+    constexpr double kMinTimeScale = 0.1;
+    constexpr double kMaxTimeScale = 1000.0;
+    if (scale <= 0.0) {
+        return;
+    }
+    if (scale < kMinTimeScale) scale = kMinTimeScale;
+    if (scale > kMaxTimeScale) scale = kMaxTimeScale;
+    time_scale_ = scale;
+}
+
+double Time::TimeScale() const {
+    return time_scale_;
+}
+
 }  // namespace snake::core
@@ -21,6 +21,10 @@ public:
     // Drops the accumulator down to at most one tick to avoid runaway loops.
     void DropAccumulatorToOneTick();
 
+    // Simulation time advances by FrameDt() * TimeScale() per frame (fast-forward).
+    void SetTimeScale(double scale);
+    double TimeScale() const;
+
 private:
     uint64_t start_counter_ = 0;
     uint64_t last_counter_ = 0;
@@ -28,5 +32,6 @@ private:
     double frame_dt_ = 0.0;
     double accumulator_ = 0.0;
     double tick_dt_ = 1.0 / 10.0;
+    double time_scale_ = 1.0;
 };
 }  // namespace snake::core
@@ -0,0 +1,79 @@
+#include "game/AliasTable.h"
+
+#include <cmath>
+
+namespace snake::game {
+
+bool AliasTable::Build(const std::vector<double>& weights) {
+    prob_.clear();
+    alias_.clear();
+
+    double sum = 0.0;
+    for (const double w : weights) {
+        if (!std::isfinite(w) || w < 0.0) {
+            return false;
+        }
+        sum += w;
+    }
+    if (weights.empty() || !(sum > 0.0) || !std::isfinite(sum)) {
+        return false;
+    }
+
+    const std::size_t n = weights.size();
+    prob_.resize(n);
+    alias_.resize(n);
+
+    // Scale so the average bucket is 1, then pair each underfull bucket with an overfull one.
+    std::vector<double> scaled(n);
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    small.reserve(n);
+    large.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        scaled[i] = weights[i] * static_cast<double>(n) / sum;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+
+    while (!small.empty() && !large.empty()) {
+        const std::uint32_t s = small.back();
+        small.pop_back();
+        const std::uint32_t l = large.back();
+        prob_[s] = scaled[s];
+        alias_[s] = l;
+        scaled[l] -= 1.0 - scaled[s];
+        if (scaled[l] < 1.0) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // Leftovers are 1 up to rounding error.
+    for (const std::uint32_t i : large) {
+        prob_[i] = 1.0;
+        alias_[i] = i;
+    }
+    for (const std::uint32_t i : small) {
+        prob_[i] = 1.0;
+        alias_[i] = i;
+    }
+    return true;
+}
+
+bool AliasTable::Empty() const {
+    return prob_.empty();
+}
+
+std::size_t AliasTable::Size() const {
+    return prob_.size();
+}
+
+std::size_t AliasTable::Sample(std::mt19937& rng) const {
+    std::uniform_real_distribution<double> dist(0.0, static_cast<double>(prob_.size()));
+    const double u = dist(rng);
+    std::size_t i = static_cast<std::size_t>(u);
+    if (i >= prob_.size()) {
+        i = prob_.size() - 1;
+    }
+    return (u - static_cast<double>(i)) < prob_[i] ? i : alias_[i];
+}
+
+}  // namespace snake::game
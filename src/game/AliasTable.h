@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace snake::game {
+
+// Walker/Vose alias table: O(n) build, O(1) weighted draw regardless of the number of outcomes.
+class AliasTable {
+public:
+    // Weights must be finite and non-negative with a positive sum; otherwise the table is left
+    // empty and false is returned.
+    bool Build(const std::vector<double>& weights);
+    bool Empty() const;
+    std::size_t Size() const;
+
+    // Index of the drawn outcome; the table must not be empty. Uses one uniform draw.
+    std::size_t Sample(std::mt19937& rng) const;
+
+private:
+    std::vector<double> prob_;
+    std::vector<std::uint32_t> alias_;
+};
+
+}  // namespace snake::game
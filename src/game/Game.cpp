@@ -183,6 +183,10 @@ int Game::BonusScore() const {
     return bonus_score_;
 }
 
+bool Game::WrapMode() const {
+    return wrap_mode_;
+}
+
 void Game::SetBoardSize(int w, int h) {
     board_.SetSize(w, h);
 }
@@ -204,6 +208,10 @@ void Game::SetSlowParams(double multiplier, double duration) {
     slow_duration_ = duration;
 }
 
+bool Game::SetBonusSpawnWeights(const std::vector<BonusSpawnWeight>& weights) {
+    return spawner_.SetBonusWeights(weights);
+}
+
 void Game::SetControls(const Controls& c) {
     controls_ = c;
 }
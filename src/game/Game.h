@@ -11,6 +11,7 @@
 #include <random>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace snake::game {
 class Game {
@@ -52,12 +53,14 @@ public:
     const TickEvents& Events() const;
     int FoodScore() const;
     int BonusScore() const;
+    bool WrapMode() const;
 
     void SetBoardSize(int w, int h);
     void SetWrapMode(bool wrap);
     void SetFoodScore(int food);
     void SetBonusScore(int bonus);
     void SetSlowParams(double multiplier, double duration);
+    bool SetBonusSpawnWeights(const std::vector<BonusSpawnWeight>& weights);
     void SetControls(const Controls& c);
 
 private:
@@ -0,0 +1,102 @@
+/* Stable C ABI for native rule modules, the compiled alternative to rules.lua
+ * (see docs/lua_api.md, section 9). A module is a shared library exporting
+ * snake_rules_get_api(); the engine loads it with SDL_LoadObject when
+ * config.rules.plugin is set. Only append fields to these structs; bump
+ * SNAKE_RULES_ABI_VERSION for any other change. */
+#ifndef SNAKE_RULES_ABI_H
+#define SNAKE_RULES_ABI_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SNAKE_RULES_ABI_VERSION 1u
+
+#if defined(_WIN32)
+#define SNAKE_RULES_EXPORT __declspec(dllexport)
+#else
+#define SNAKE_RULES_EXPORT __attribute__((visibility("default")))
+#endif
+
+enum {
+    SNAKE_DIR_UP = 0,
+    SNAKE_DIR_DOWN = 1,
+    SNAKE_DIR_LEFT = 2,
+    SNAKE_DIR_RIGHT = 3
+};
+
+enum {
+    SNAKE_BONUS_NONE = 0, /* spawn-table outcome only: no bonus this roll */
+    SNAKE_BONUS_SCORE = 1,
+    SNAKE_BONUS_SLOW = 2
+};
+
+/* Snapshot of the round passed to hooks as ctx; the same fields as the Lua GameView.
+ * Valid only for the duration of the call. */
+typedef struct SnakeRulesCtx {
+    uint32_t struct_size;
+    int32_t score;
+    int32_t length;
+    int32_t dir; /* SNAKE_DIR_* */
+    int32_t board_w;
+    int32_t board_h;
+    int32_t wrap_mode;
+    int32_t game_over;
+    int32_t slow_active;
+    double slow_multiplier;
+    double slow_remaining;
+    int32_t food_score;
+    int32_t bonus_score;
+    int32_t bonus_count;
+    int32_t head_x;
+    int32_t head_y;
+    int32_t has_food;
+    int32_t food_x;
+    int32_t food_y;
+} SnakeRulesCtx;
+
+typedef struct SnakeBonusWeight {
+    int32_t type; /* SNAKE_BONUS_* */
+    double weight;
+} SnakeBonusWeight;
+
+/* Every function pointer except create/destroy may be NULL (hook absent). `self` is the value
+ * returned by create; each engine instance creates its own, so modules need no locking unless
+ * they share globals. Strings are NUL-terminated and only valid during the call. */
+typedef struct SnakeRulesApi {
+    uint32_t abi_version; /* SNAKE_RULES_ABI_VERSION */
+    uint32_t struct_size; /* sizeof(SnakeRulesApi) */
+    const char* name;
+
+    void* (*create)(void);
+    void (*destroy)(void* self);
+
+    /* Required: base speed in ticks per second (> 0), like speed_ticks_per_sec(score, config).
+     * Must be pure in score; the engine may cache results per score. */
+    double (*speed_ticks_per_sec)(void* self, int32_t score);
+
+    void (*on_app_init)(void* self, const SnakeRulesCtx* ctx);
+    void (*on_round_start)(void* self, const SnakeRulesCtx* ctx);
+    void (*on_tick_begin)(void* self, const SnakeRulesCtx* ctx);
+    void (*on_tick_end)(void* self, const SnakeRulesCtx* ctx);
+    void (*on_food_eaten)(void* self, const SnakeRulesCtx* ctx);
+    void (*on_bonus_picked)(void* self, const SnakeRulesCtx* ctx, const char* bonus_type);
+    void (*on_game_over)(void* self, const SnakeRulesCtx* ctx, const char* reason);
+    void (*on_setting_changed)(void* self, const SnakeRulesCtx* ctx, const char* key);
+
+    /* Optional bonus spawn table (same meaning as the Lua bonus_spawn table). */
+    const SnakeBonusWeight* bonus_spawn;
+    int32_t bonus_spawn_count;
+} SnakeRulesApi;
+
+typedef const SnakeRulesApi* (*SnakeRulesGetApiFn)(void);
+
+SNAKE_RULES_EXPORT const SnakeRulesApi* snake_rules_get_api(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNAKE_RULES_ABI_H */
@@ -0,0 +1,182 @@
+#include "game/RulesPlugin.h"
+
+#include <SDL.h>
+
+#include "game/Game.h"
+
+namespace snake::game {
+
+namespace {
+std::int32_t DirCode(Dir d) {
+    switch (d) {
+        case Dir::Up: return SNAKE_DIR_UP;
+        case Dir::Down: return SNAKE_DIR_DOWN;
+        case Dir::Left: return SNAKE_DIR_LEFT;
+        case Dir::Right: return SNAKE_DIR_RIGHT;
+    }
+    return SNAKE_DIR_RIGHT;
+}
+}  // namespace
+
+RulesPlugin::~RulesPlugin() {
+    Unload();
+}
+
+bool RulesPlugin::Load(const std::filesystem::path& path, std::string* error) {
+    Unload();
+
+    handle_ = SDL_LoadObject(path.string().c_str());
+    if (handle_ == nullptr) {
+        *error = SDL_GetError();
+        return false;
+    }
+    auto get_api = reinterpret_cast<SnakeRulesGetApiFn>(SDL_LoadFunction(handle_, "snake_rules_get_api"));
+    const SnakeRulesApi* api = get_api ? get_api() : nullptr;
+    if (api == nullptr) {
+        *error = "snake_rules_get_api not found";
+    } else if (api->abi_version != SNAKE_RULES_ABI_VERSION) {
+        *error = "ABI version " + std::to_string(api->abi_version) + ", expected " +
+                 std::to_string(SNAKE_RULES_ABI_VERSION);
+    } else if (api->struct_size < sizeof(SnakeRulesApi)) {
+        *error = "SnakeRulesApi is smaller than this engine expects";
+    } else if (api->create == nullptr || api->destroy == nullptr || api->speed_ticks_per_sec == nullptr) {
+        *error = "create, destroy and speed_ticks_per_sec are required";
+    } else {
+        api_ = api;
+    }
+    if (api_ == nullptr) {
+        Unload();
+        return false;
+    }
+
+    self_ = api_->create();
+    name_ = api_->name ? api_->name : path.filename().string();
+    for (std::int32_t i = 0; api_->bonus_spawn != nullptr && i < api_->bonus_spawn_count; ++i) {
+        const SnakeBonusWeight& w = api_->bonus_spawn[i];
+        BonusSpawnWeight entry;
+        entry.weight = w.weight;
+        if (w.type == SNAKE_BONUS_SCORE) {
+            entry.type = BonusType::Score;
+        } else if (w.type == SNAKE_BONUS_SLOW) {
+            entry.type = BonusType::Slow;
+        } else if (w.type != SNAKE_BONUS_NONE) {
+            continue;
+        }
+        bonus_spawn_.push_back(entry);
+    }
+    return true;
+}
+
+void RulesPlugin::Unload() {
+    if (api_ != nullptr && self_ != nullptr) {
+        api_->destroy(self_);
+    }
+    self_ = nullptr;
+    api_ = nullptr;
+    if (handle_ != nullptr) {
+        SDL_UnloadObject(handle_);
+        handle_ = nullptr;
+    }
+    name_.clear();
+    bonus_spawn_.clear();
+    speed_cache_.clear();
+}
+
+bool RulesPlugin::IsLoaded() const {
+    return api_ != nullptr;
+}
+
+const std::string& RulesPlugin::Name() const {
+    return name_;
+}
+
+bool RulesPlugin::GetBaseTicksPerSec(int score, double* out_ticks_per_sec) {
+    if (api_ == nullptr) {
+        return false;
+    }
+    const auto it = speed_cache_.find(score);
+    if (it != speed_cache_.end()) {
+        *out_ticks_per_sec = it->second;
+        return true;
+    }
+    const double tps = api_->speed_ticks_per_sec(self_, score);
+    if (!(tps > 0.0)) {
+        return false;
+    }
+    speed_cache_.emplace(score, tps);
+    *out_ticks_per_sec = tps;
+    return true;
+}
+
+const std::vector<BonusSpawnWeight>& RulesPlugin::BonusSpawnWeights() const {
+    return bonus_spawn_;
+}
+
+void RulesPlugin::OnAppInit(const Game& game) {
+    if (api_ && api_->on_app_init) api_->on_app_init(self_, Snapshot(game));
+}
+
+void RulesPlugin::OnRoundStart(const Game& game) {
+    if (api_ && api_->on_round_start) api_->on_round_start(self_, Snapshot(game));
+}
+
+void RulesPlugin::OnTickBegin(const Game& game) {
+    if (api_ && api_->on_tick_begin) api_->on_tick_begin(self_, Snapshot(game));
+}
+
+void RulesPlugin::OnTickEnd(const Game& game) {
+    if (api_ && api_->on_tick_end) api_->on_tick_end(self_, Snapshot(game));
+}
+
+void RulesPlugin::OnFoodEaten(const Game& game) {
+    if (api_ && api_->on_food_eaten) api_->on_food_eaten(self_, Snapshot(game));
+}
+
+void RulesPlugin::OnBonusPicked(const Game& game, const std::string& bonus_type) {
+    if (api_ && api_->on_bonus_picked) {
+        api_->on_bonus_picked(self_, Snapshot(game), bonus_type.c_str());
+    }
+}
+
+void RulesPlugin::OnGameOver(const Game& game, std::string_view reason) {
+    if (api_ && api_->on_game_over) {
+        const std::string text(reason);
+        api_->on_game_over(self_, Snapshot(game), text.c_str());
+    }
+}
+
+void RulesPlugin::OnSettingChanged(const Game& game, const std::string& key) {
+    if (api_ && api_->on_setting_changed) {
+        api_->on_setting_changed(self_, Snapshot(game), key.c_str());
+    }
+}
+
+const SnakeRulesCtx* RulesPlugin::Snapshot(const Game& game) {
+    const Snake& snake = game.GetSnake();
+    const Effects& effects = game.GetEffects();
+    const Spawner& spawner = game.GetSpawner();
+    ctx_.struct_size = sizeof(SnakeRulesCtx);
+    ctx_.score = game.GetScore().Score();
+    ctx_.length = snake.Length();
+    ctx_.dir = DirCode(snake.Direction());
+    ctx_.board_w = game.GetBoard().W();
+    ctx_.board_h = game.GetBoard().H();
+    ctx_.wrap_mode = game.WrapMode() ? 1 : 0;
+    ctx_.game_over = game.IsGameOver() ? 1 : 0;
+    ctx_.slow_active = effects.SlowActive() ? 1 : 0;
+    ctx_.slow_multiplier = effects.SlowMultiplier();
+    ctx_.slow_remaining = effects.SlowRemaining();
+    ctx_.food_score = game.FoodScore();
+    ctx_.bonus_score = game.BonusScore();
+    ctx_.bonus_count = spawner.BonusCount();
+    const Pos head = snake.Head();
+    ctx_.head_x = head.x;
+    ctx_.head_y = head.y;
+    ctx_.has_food = spawner.HasFood() ? 1 : 0;
+    const Pos food = spawner.FoodPos();
+    ctx_.food_x = food.x;
+    ctx_.food_y = food.y;
+    return &ctx_;
+}
+
+}  // namespace snake::game
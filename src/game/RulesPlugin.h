@@ -0,0 +1,55 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "game/RulesAbi.h"
+#include "game/Spawner.h"
+
+namespace snake::game {
+
+class Game;
+
+// A native rule module (game/RulesAbi.h) loaded from a shared library. Mirrors the subset of
+// LuaRuntime that App drives per tick; absent hooks cost one null check.
+class RulesPlugin {
+public:
+    RulesPlugin() = default;
+    ~RulesPlugin();
+    RulesPlugin(const RulesPlugin&) = delete;
+    RulesPlugin& operator=(const RulesPlugin&) = delete;
+
+    bool Load(const std::filesystem::path& path, std::string* error);
+    void Unload();
+    bool IsLoaded() const;
+    const std::string& Name() const;
+
+    bool GetBaseTicksPerSec(int score, double* out_ticks_per_sec);
+    // Empty if the module has no spawn table (the spawner then keeps its default).
+    const std::vector<BonusSpawnWeight>& BonusSpawnWeights() const;
+
+    void OnAppInit(const Game& game);
+    void OnRoundStart(const Game& game);
+    void OnTickBegin(const Game& game);
+    void OnTickEnd(const Game& game);
+    void OnFoodEaten(const Game& game);
+    void OnBonusPicked(const Game& game, const std::string& bonus_type);
+    void OnGameOver(const Game& game, std::string_view reason);
+    void OnSettingChanged(const Game& game, const std::string& key);
+
+private:
+    void* handle_ = nullptr;  // SDL_LoadObject handle
+    const SnakeRulesApi* api_ = nullptr;
+    void* self_ = nullptr;
+    std::string name_;
+    std::vector<BonusSpawnWeight> bonus_spawn_;
+    std::unordered_map<int, double> speed_cache_;
+    SnakeRulesCtx ctx_{};
+
+    const SnakeRulesCtx* Snapshot(const Game& game);
+};
+
+}  // namespace snake::game
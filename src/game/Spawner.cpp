@@ -4,6 +4,39 @@
 
 namespace snake::game {
 
+namespace {
+const std::vector<BonusSpawnWeight>& DefaultBonusWeights() {
+    static const std::vector<BonusSpawnWeight> kDefaults{
+        {std::nullopt, 0.80},
+        {BonusType::Score, 0.10},
+        {BonusType::Slow, 0.10},
+    };
+    return kDefaults;
+}
+}  // namespace
+
+Spawner::Spawner() {
+    SetBonusWeights({});
+}
+
+bool Spawner::SetBonusWeights(const std::vector<BonusSpawnWeight>& weights) {
+    const auto build = [this](const std::vector<BonusSpawnWeight>& entries) {
+        std::vector<double> w;
+        w.reserve(entries.size());
+        bonus_outcomes_.clear();
+        for (const auto& e : entries) {
+            w.push_back(e.weight);
+            bonus_outcomes_.push_back(e.type);
+        }
+        return bonus_alias_.Build(w);
+    };
+    if (!weights.empty() && build(weights)) {
+        return true;
+    }
+    build(DefaultBonusWeights());
+    return weights.empty();
+}
+
 void Spawner::Reset() {
     food_.reset();
     bonuses_.clear();
@@ -27,9 +60,9 @@ void Spawner::MaybeSpawnBonus(const Board& b, const Snake& s, std::mt19937& rng,
         return;
     }
 
-    // TODO(genetrus): Make spawn probability configurable via Lua.
-    std::uniform_real_distribution<double> chance_dist(0.0, 1.0);
-    if (chance_dist(rng) >= 0.20) {
+    // Chance and type come from one alias-table draw (weights from rules.lua, see SetBonusWeights).
+    const std::optional<BonusType> type = bonus_outcomes_[bonus_alias_.Sample(rng)];
+    if (!type.has_value()) {
         return;
     }
 
@@ -38,9 +71,7 @@ void Spawner::MaybeSpawnBonus(const Board& b, const Snake& s, std::mt19937& rng,
         return;
     }
 
-    std::uniform_real_distribution<double> type_dist(0.0, 1.0);
-    const BonusType type = type_dist(rng) < 0.50 ? BonusType::Score : BonusType::Slow;
-    bonuses_.push_back(Bonus{*free_cell, type});
+    bonuses_.push_back(Bonus{*free_cell, *type});
 
     if (bonuses_.size() > 2) {
         bonuses_.resize(2);
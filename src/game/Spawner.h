@@ -4,6 +4,7 @@
 #include <random>
 #include <vector>
 
+#include "game/AliasTable.h"
 #include "game/Board.h"
 #include "game/Snake.h"
 #include "game/Types.h"
@@ -20,9 +21,19 @@ struct Bonus {
     BonusType type;
 };
 
+// One outcome of a bonus spawn roll; an empty type means "spawn nothing".
+struct BonusSpawnWeight {
+    std::optional<BonusType> type;
+    double weight = 0.0;
+};
+
 class Spawner {
 public:
+    Spawner();
     void Reset();
+    // Rebuilds the spawn roll table; an empty or invalid list restores the default
+    // (20% chance, then 50/50 score/slow). Kept across Reset.
+    bool SetBonusWeights(const std::vector<BonusSpawnWeight>& weights);
     void EnsureFood(const Board& b, const Snake& s, std::mt19937& rng);     // guarantee 1 food
     void RespawnFood(const Board& b, const Snake& s, std::mt19937& rng);
     void MaybeSpawnBonus(const Board& b, const Snake& s, std::mt19937& rng, int current_score);
@@ -39,6 +50,8 @@ public:
 private:
     std::optional<Pos> food_;
     std::vector<Bonus> bonuses_;
+    AliasTable bonus_alias_;
+    std::vector<std::optional<BonusType>> bonus_outcomes_;  // indexed like bonus_alias_
 
     std::optional<Pos> RandomFreeCell(const Board& b,
                                       const Snake& s,
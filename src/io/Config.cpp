@@ -9,6 +9,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "lua/ChunkCache.h"
+
 namespace snake::io {
 
 namespace {
@@ -19,6 +21,7 @@ constexpr int kMinTilePx = 8;
 constexpr int kMaxTilePx = 128;
 constexpr int kMinWindow = 320;
 constexpr int kMaxWindow = 3840;
+constexpr int kMaxLuaInstructionBudget = 1'000'000'000;
 
 const KeyBinds& DefaultKeybinds() {
     static const KeyBinds kDefaults{};
@@ -216,14 +219,12 @@ bool Config::LoadFromFile(const std::filesystem::path& path) {
     luaL_openlibs(L);
 
     bool ok = true;
-    if (luaL_loadfile(L, path.string().c_str()) != LUA_OK) {
+    if (snake::lua::LoadChunkCached(L, path) != LUA_OK) {
         ok = false;
     } else if (lua_pcall(L, 0, LUA_MULTRET, 0) != LUA_OK) {
         ok = false;
     }
 
-    ConfigData loaded = data_;
-
     if (ok) {
         if (lua_gettop(L) > 0 && lua_istable(L, -1)) {
             lua_setglobal(L, "config");
@@ -232,10 +233,18 @@ bool Config::LoadFromFile(const std::filesystem::path& path) {
         }
     }
 
+    const bool read = LoadFromLua(L);
+    lua_close(L);
+    return ok && read;
+}
+
+bool Config::LoadFromLua(lua_State* L) {
+    const int top = lua_gettop(L);
+    ConfigData loaded = data_;
+
     lua_getglobal(L, "config");
     if (!lua_istable(L, -1)) {
-        lua_pop(L, 1);
-        lua_close(L);
+        lua_settop(L, top);
         Sanitize();
         return false;
     }
@@ -313,6 +322,18 @@ bool Config::LoadFromFile(const std::filesystem::path& path) {
     }
     lua_pop(L, 1);
 
+    lua_getfield(L, -1, "lua");
+    if (lua_istable(L, -1)) {
+        LoadIntField(L, "instruction_budget", &loaded.lua.instruction_budget);
+    }
+    lua_pop(L, 1);
+
+    lua_getfield(L, -1, "rules");
+    if (lua_istable(L, -1)) {
+        LoadStringField(L, "plugin", &loaded.rules.plugin);
+    }
+    lua_pop(L, 1);
+
     lua_getfield(L, -1, "ui");
     if (lua_istable(L, -1)) {
         std::string mode;
@@ -359,12 +380,11 @@ bool Config::LoadFromFile(const std::filesystem::path& path) {
     }
     lua_pop(L, 1);  // keys
 
-    lua_pop(L, 1);  // config
-    lua_close(L);
+    lua_settop(L, top);  // config
 
     data_ = loaded;
     Sanitize();
-    return ok;
+    return true;
 }
 
 bool Config::SaveToFile(const std::filesystem::path& path) const {
@@ -411,6 +431,8 @@ bool Config::SaveToFile(const std::filesystem::path& path) const {
         << ", slow_duration_sec = " << data_.gameplay.slow_duration_sec
         << ", max_simultaneous_bonuses = " << data_.gameplay.max_simultaneous_bonuses
         << ", always_one_food = " << b(data_.gameplay.always_one_food) << " },\n";
+    ofs << "  lua = { instruction_budget = " << data_.lua.instruction_budget << " },\n";
+    ofs << "  rules = { plugin = \"" << EscapeLuaString(data_.rules.plugin) << "\" },\n";
     ofs << "}\n";
 
     ofs.close();
@@ -445,6 +467,7 @@ void Config::Sanitize() {
     data_.gameplay.max_simultaneous_bonuses = std::max(0, data_.gameplay.max_simultaneous_bonuses);
     data_.gameplay.slow_multiplier = std::max(0.0, data_.gameplay.slow_multiplier);
     data_.gameplay.slow_duration_sec = std::max(0.0, data_.gameplay.slow_duration_sec);
+    data_.lua.instruction_budget = clamp(data_.lua.instruction_budget, 0, kMaxLuaInstructionBudget);
     data_.player_name = SanitizePlayerName(data_.player_name);
     data_.ui.panel_mode = NormalizePanelMode(data_.ui.panel_mode);
 
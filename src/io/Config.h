@@ -6,6 +6,8 @@
 #include <string>
 #include <string_view>
 
+struct lua_State;
+
 namespace snake::io {
 
 enum class WallMode { Death, Wrap };
@@ -60,6 +62,14 @@ struct GameplayConfig {
     int bonus_score_score = 50;
 };
 
+struct LuaConfig {
+    int instruction_budget = 0;  // per Lua call; 0 = unlimited
+};
+
+struct RulesConfig {
+    std::string plugin;  // native rule module (shared library); empty = assets/scripts/rules.lua
+};
+
 struct ConfigData {
     std::string player_name = "Player";
     WindowConfig window;
@@ -67,6 +77,8 @@ struct ConfigData {
     AudioConfig audio;
     UIConfig ui;
     GameplayConfig gameplay;
+    LuaConfig lua;
+    RulesConfig rules;
     KeyBinds keys;
 };
 
@@ -76,6 +88,9 @@ std::string SanitizePlayerName(std::string name);
 class Config {
 public:
     bool LoadFromFile(const std::filesystem::path& path);
+    // Reads the global `config` table of a state that has already run config.lua, so the
+    // Lua runtime and the typed config share one parse. The stack is left unchanged.
+    bool LoadFromLua(lua_State* L);
     bool SaveToFile(const std::filesystem::path& path) const;  // atomic write
 
     const ConfigData& Data() const;
@@ -0,0 +1,153 @@
+#include "io/FileWatcher.h"
+
+#include <algorithm>
+#include <system_error>
+#include <utility>
+
+namespace snake::io {
+
+namespace {
+template <typename T>
+bool ByPath(const T& a, const T& b) {
+    return a.path < b.path;
+}
+
+// Appends the paths that were added, removed or modified between two sorted snapshots.
+template <typename T>
+void AppendChangedPaths(const std::vector<T>& before,
+                        const std::vector<T>& after,
+                        std::vector<std::filesystem::path>* out) {
+    for (const auto& stamp : after) {
+        const auto it = std::lower_bound(before.begin(), before.end(), stamp, ByPath<T>);
+        if (it == before.end() || !(*it == stamp)) {
+            out->push_back(stamp.path);
+        }
+    }
+    for (const auto& stamp : before) {
+        if (!std::binary_search(after.begin(), after.end(), stamp, ByPath<T>)) {
+            out->push_back(stamp.path);
+        }
+    }
+}
+}  // namespace
+
+FileWatcher::~FileWatcher() {
+    Stop();
+}
+
+void FileWatcher::Start(std::vector<std::filesystem::path> paths, std::chrono::milliseconds interval) {
+    Stop();
+    paths_ = std::move(paths);
+    interval_ = interval;
+    stop_ = false;
+    changed_.store(false);
+    thread_ = std::thread(&FileWatcher::Run, this);
+}
+
+void FileWatcher::Stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+bool FileWatcher::ConsumeChange() {
+    return changed_.exchange(false);
+}
+
+void FileWatcher::IgnoreOwnWrite(const std::filesystem::path& path) {
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return;
+    }
+    const auto size = std::filesystem::file_size(path, ec);
+    const Stamp stamp{path, mtime, ec ? 0 : size};
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(own_writes_.begin(), own_writes_.end(), [&](const Stamp& s) {
+        return s.path == path;
+    });
+    if (it != own_writes_.end()) {
+        *it = stamp;
+    } else {
+        own_writes_.push_back(stamp);
+    }
+}
+
+bool FileWatcher::OnlyOwnWrites(const std::vector<std::filesystem::path>& changed,
+                                const std::vector<Stamp>& now) const {
+    for (const auto& path : changed) {
+        const auto own = std::find_if(own_writes_.begin(), own_writes_.end(), [&](const Stamp& s) {
+            return s.path == path;
+        });
+        if (own == own_writes_.end()) {
+            return false;
+        }
+        const auto cur = std::lower_bound(now.begin(), now.end(), *own, ByPath<Stamp>);
+        if (cur == now.end() || !(*cur == *own)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<FileWatcher::Stamp> FileWatcher::Snapshot() const {
+    std::vector<Stamp> stamps;
+    auto add = [&stamps](const std::filesystem::path& p) {
+        std::error_code ec;
+        const auto mtime = std::filesystem::last_write_time(p, ec);
+        if (ec) {
+            return;
+        }
+        const auto size = std::filesystem::file_size(p, ec);
+        stamps.push_back(Stamp{p, mtime, ec ? 0 : size});
+    };
+
+    for (const auto& path : paths_) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(path, ec)) {
+            for (std::filesystem::recursive_directory_iterator it(path, ec), end; !ec && it != end;
+                 it.increment(ec)) {
+                if (it->is_regular_file(ec)) {
+                    add(it->path());
+                }
+            }
+        } else {
+            add(path);
+        }
+    }
+    std::sort(stamps.begin(), stamps.end(), ByPath<Stamp>);
+    return stamps;
+}
+
+void FileWatcher::Run() {
+    std::vector<Stamp> last = Snapshot();
+    std::vector<std::filesystem::path> changed;  // paths touched since the last report
+    bool settling = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!wake_.wait_for(lock, interval_, [this] { return stop_; })) {
+        lock.unlock();
+        std::vector<Stamp> now = Snapshot();
+        lock.lock();
+        if (now != last) {
+            AppendChangedPaths(last, now, &changed);
+            last = std::move(now);
+            settling = true;
+        } else if (settling) {
+            settling = false;
+            if (!OnlyOwnWrites(changed, last)) {
+                changed_.store(true);
+            }
+            changed.clear();
+        }
+    }
+}
+
+}  // namespace snake::io
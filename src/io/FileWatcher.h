@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace snake::io {
+
+// Watches files and directories (recursively) for changes from a background thread.
+// Polls modification times rather than using OS notifications so it behaves the same on
+// Windows and elsewhere; a change is reported once the files have been stable for one
+// poll interval, so editors that save in several steps trigger a single reload.
+class FileWatcher {
+public:
+    FileWatcher() = default;
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    void Start(std::vector<std::filesystem::path> paths,
+               std::chrono::milliseconds interval = std::chrono::milliseconds(250));
+    void Stop();
+
+    // True once per detected change (thread-safe, cheap to call every frame).
+    bool ConsumeChange();
+    // Call right after the program itself writes `path`: a change that leaves the file exactly
+    // as it is now (same mtime and size) is not reported. Later edits are reported as usual.
+    void IgnoreOwnWrite(const std::filesystem::path& path);
+
+private:
+    struct Stamp {
+        std::filesystem::path path;
+        std::filesystem::file_time_type mtime;
+        std::uintmax_t size = 0;
+
+        bool operator==(const Stamp&) const = default;
+    };
+
+    std::vector<Stamp> Snapshot() const;
+    void Run();
+    // True if every path in `changed` is at the stamp recorded by IgnoreOwnWrite. Needs mutex_.
+    bool OnlyOwnWrites(const std::vector<std::filesystem::path>& changed, const std::vector<Stamp>& now) const;
+
+    std::vector<std::filesystem::path> paths_;
+    std::chrono::milliseconds interval_{250};
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<Stamp> own_writes_;  // guarded by mutex_
+    bool stop_ = false;
+    std::atomic<bool> changed_{false};
+};
+
+}  // namespace snake::io
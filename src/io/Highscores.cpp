@@ -85,6 +85,7 @@ void SortAndTrim(std::vector<Entry>& entries) {
 }  // namespace
 
 bool Highscores::Load(const std::filesystem::path& path) {
+    ++revision_;
     entries_.clear();
     std::ifstream ifs(path);
     if (!ifs) {
@@ -149,6 +150,10 @@ const std::vector<Entry>& Highscores::Entries() const {
     return entries_;
 }
 
+std::uint64_t Highscores::Revision() const {
+    return revision_;
+}
+
 bool Highscores::Qualifies(int score) const {
     if (entries_.size() < kMaxEntries) {
         return true;
@@ -159,6 +164,7 @@ bool Highscores::Qualifies(int score) const {
 bool Highscores::TryInsert(const Entry& entry) {
     Entry sanitized = entry;
     sanitized.name = SanitizeEntryName(std::move(sanitized.name));
+    ++revision_;
     entries_.push_back(sanitized);
     SortAndTrim(entries_);
 
@@ -168,6 +174,7 @@ bool Highscores::TryInsert(const Entry& entry) {
 }
 
 void Highscores::Clear() {
+    ++revision_;
     entries_.clear();
 }
 
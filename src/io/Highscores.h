@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -17,6 +18,8 @@ public:
     bool Load(const std::filesystem::path& path);
     bool Save(const std::filesystem::path& path) const;
     const std::vector<Entry>& Entries() const;
+    // Bumped on every Load/TryInsert/Clear; lets views skip re-layout when nothing changed.
+    std::uint64_t Revision() const;
 
     bool Qualifies(int score) const;
 
@@ -29,6 +32,7 @@ public:
 
 private:
     std::vector<Entry> entries_;
+    std::uint64_t revision_ = 0;
 };
 
 }  // namespace snake::io
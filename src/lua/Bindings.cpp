@@ -2,8 +2,14 @@
 
 #include <lua.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <functional>
 #include <iostream>
 #include <string_view>
+#include <unordered_map>
+
+#include "io/Config.h"
 
 namespace snake::lua {
 
@@ -22,15 +28,46 @@ bool EvalString(lua_State* L, const char* expr) {
     return luaL_dostring(L, expr) == LUA_OK;
 }
 
-bool GetValue(lua_State* L, const char* expr, int type_expected) {
-    if (!EvalString(L, expr)) {
-        lua_pop(L, 1);  // error message
-        return false;
+struct StringHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view s) const {
+        return std::hash<std::string_view>{}(s);
     }
-    const bool ok = lua_type(L, -1) == type_expected;
-    if (!ok) {
-        lua_pop(L, 1);
+};
+
+bool IsReservedWord(std::string_view s) {
+    static constexpr std::string_view kWords[] = {
+        "and", "break", "do", "else", "elseif", "end", "false", "for", "function", "goto", "if",
+        "in", "local", "nil", "not", "or", "repeat", "return", "then", "true", "until", "while",
+    };
+    return std::find(std::begin(kWords), std::end(kWords), s) != std::end(kWords);
+}
+
+// Pop* consume the value on top of the stack and store it if it has the expected type.
+bool PopInt(lua_State* L, int* out) {
+    const bool ok = lua_isinteger(L, -1);
+    if (ok) {
+        *out = static_cast<int>(lua_tointeger(L, -1));
     }
+    lua_pop(L, 1);
+    return ok;
+}
+
+bool PopBool(lua_State* L, bool* out) {
+    const bool ok = lua_isboolean(L, -1);
+    if (ok) {
+        *out = lua_toboolean(L, -1) != 0;
+    }
+    lua_pop(L, 1);
+    return ok;
+}
+
+bool PopString(lua_State* L, std::string* out) {
+    const bool ok = lua_isstring(L, -1);
+    if (ok) {
+        out->assign(lua_tostring(L, -1));
+    }
+    lua_pop(L, 1);
     return ok;
 }
 
@@ -62,54 +99,164 @@ void Bindings::Register(lua_State* L) {
     lua_setglobal(L, "snake");
 }
 
-bool Bindings::GetInt(lua_State* L, const char* expr, int* out) {
-    if (!out) return false;
-    const std::string wrapped = "return " + std::string(expr);
-    if (!EvalString(L, wrapped.c_str())) {
-        lua_pop(L, 1);
-        return false;
+LuaPath::LuaPath(std::string_view path) {
+    if (!Parse(path)) {
+        keys_.clear();
     }
-    if (!lua_isinteger(L, -1)) {
-        lua_pop(L, 1);
-        return false;
+}
+
+bool LuaPath::Parse(std::string_view path) {
+    std::size_t i = 0;
+    auto is_ident_start = [](char c) {
+        return std::isalpha(static_cast<unsigned char>(c)) != 0 || c == '_';
+    };
+    auto is_ident = [&](char c) {
+        return is_ident_start(c) || std::isdigit(static_cast<unsigned char>(c)) != 0;
+    };
+
+    while (i < path.size()) {
+        if (path[i] == '[') {
+            if (keys_.empty()) {
+                return false;
+            }
+            const std::size_t close = path.find(']', i);
+            if (close == std::string_view::npos || close == i + 1) {
+                return false;
+            }
+            lua_Integer index = 0;
+            bool digits = true;
+            for (std::size_t j = i + 1; j < close; ++j) {
+                if (std::isdigit(static_cast<unsigned char>(path[j])) == 0) {
+                    digits = false;
+                    break;
+                }
+                index = index * 10 + (path[j] - '0');
+            }
+            if (!digits) {
+                return false;
+            }
+            keys_.push_back(Key{std::string(), index});
+            i = close + 1;
+        } else {
+            if (!keys_.empty()) {
+                if (path[i] != '.') {
+                    return false;
+                }
+                ++i;
+            }
+            const std::size_t begin = i;
+            if (i >= path.size() || !is_ident_start(path[i])) {
+                return false;
+            }
+            while (i < path.size() && is_ident(path[i])) {
+                ++i;
+            }
+            const std::string_view name = path.substr(begin, i - begin);
+            if (IsReservedWord(name)) {
+                return false;  // `true`, `nil`, `not x`...: leave it to the Lua parser
+            }
+            keys_.push_back(Key{std::string(name), 0});
+        }
     }
-    *out = static_cast<int>(lua_tointeger(L, -1));
-    lua_pop(L, 1);
     return true;
 }
 
-bool Bindings::GetBool(lua_State* L, const char* expr, bool* out) {
-    if (!out) return false;
-    const std::string wrapped = "return " + std::string(expr);
-    if (!EvalString(L, wrapped.c_str())) {
-        lua_pop(L, 1);
-        return false;
+bool LuaPath::Valid() const {
+    return !keys_.empty();
+}
+
+int LuaPath::Push(lua_State* L) const {
+    if (keys_.empty()) {
+        lua_pushnil(L);
+        return LUA_TNIL;
     }
-    if (!lua_isboolean(L, -1)) {
+    // Stepping into a table or userdata can run an __index that raises (strict-mode tables,
+    // userdata without __index), so the walk runs protected, like the old luaL_dostring path.
+    lua_pushcfunction(L, &LuaPath::Walk);
+    lua_pushlightuserdata(L, const_cast<LuaPath*>(this));
+    if (lua_pcall(L, 1, 1, 0) != LUA_OK) {
         lua_pop(L, 1);
-        return false;
+        lua_pushnil(L);
+        return LUA_TNIL;
     }
-    *out = lua_toboolean(L, -1) != 0;
-    lua_pop(L, 1);
-    return true;
+    return lua_type(L, -1);
 }
 
-bool Bindings::GetString(lua_State* L, const char* expr, std::string* out) {
-    if (!out) return false;
+int LuaPath::Walk(lua_State* L) {
+    const auto* self = static_cast<const LuaPath*>(lua_touserdata(L, 1));
+    lua_settop(L, 0);
+    int type = lua_getglobal(L, self->keys_.front().name.c_str());
+    for (std::size_t i = 1; i < self->keys_.size(); ++i) {
+        if (type != LUA_TTABLE && type != LUA_TUSERDATA) {
+            lua_pushnil(L);
+            return 1;
+        }
+        const Key& key = self->keys_[i];
+        type = key.name.empty() ? lua_geti(L, -1, key.index) : lua_getfield(L, -1, key.name.c_str());
+        lua_remove(L, -2);
+    }
+    return 1;
+}
+
+bool Bindings::PushExpr(lua_State* L, const char* expr) {
+    // Paths are parsed once per distinct expression; the map only grows with the number of
+    // call sites, not with calls.
+    thread_local std::unordered_map<std::string, LuaPath, StringHash, std::equal_to<>> cache;
+    const std::string_view key(expr);
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        it = cache.emplace(std::string(key), LuaPath(key)).first;
+    }
+    if (it->second.Valid()) {
+        it->second.Push(L);
+        return true;
+    }
+
     const std::string wrapped = "return " + std::string(expr);
     if (!EvalString(L, wrapped.c_str())) {
         lua_pop(L, 1);
         return false;
     }
-    if (!lua_isstring(L, -1)) {
-        lua_pop(L, 1);
-        return false;
-    }
-    out->assign(lua_tostring(L, -1));
-    lua_pop(L, 1);
     return true;
 }
 
+bool Bindings::GetInt(lua_State* L, const char* expr, int* out) {
+    if (!out || !PushExpr(L, expr)) return false;
+    return PopInt(L, out);
+}
+
+bool Bindings::GetBool(lua_State* L, const char* expr, bool* out) {
+    if (!out || !PushExpr(L, expr)) return false;
+    return PopBool(L, out);
+}
+
+bool Bindings::GetString(lua_State* L, const char* expr, std::string* out) {
+    if (!out || !PushExpr(L, expr)) return false;
+    return PopString(L, out);
+}
+
+bool Bindings::GetInt(lua_State* L, const LuaPath& path, int* out) {
+    if (!out) return false;
+    path.Push(L);
+    return PopInt(L, out);
+}
+
+bool Bindings::GetBool(lua_State* L, const LuaPath& path, bool* out) {
+    if (!out) return false;
+    path.Push(L);
+    return PopBool(L, out);
+}
+
+bool Bindings::GetString(lua_State* L, const LuaPath& path, std::string* out) {
+    if (!out) return false;
+    path.Push(L);
+    return PopString(L, out);
+}
+
+bool Bindings::ReadConfig(lua_State* L, snake::io::Config* out) {
+    return out != nullptr && out->LoadFromLua(L);
+}
+
 int Bindings::l_log(lua_State* L) {
     const char* msg = luaL_optstring(L, 1, "");
     std::cout << "[lua] " << msg << std::endl;
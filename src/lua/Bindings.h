@@ -3,19 +3,60 @@
 #include <lua.hpp>
 
 #include <string>
+#include <string_view>
+#include <vector>
+
+namespace snake::io {
+class Config;
+}
 
 namespace snake::lua {
 
+// Dotted path such as `config.gameplay.food_score` or `config.keybinds.up[1]`, split into
+// keys once and walked with lua_getfield/lua_geti instead of compiling `return <expr>`.
+class LuaPath {
+public:
+    LuaPath() = default;
+    explicit LuaPath(std::string_view path);
+
+    // False if `path` is not a plain path (operators, calls, string keys...).
+    bool Valid() const;
+    // Pushes the value at the path, or nil if a step is missing or raises. Returns its Lua type.
+    int Push(lua_State* L) const;
+
+private:
+    struct Key {
+        std::string name;       // empty for integer index steps
+        lua_Integer index = 0;
+    };
+    std::vector<Key> keys_;
+
+    bool Parse(std::string_view path);
+    static int Walk(lua_State* L);  // lua_CFunction run under lua_pcall by Push
+};
+
 class Bindings {
 public:
     static void Register(lua_State* L);
 
+    // `expr` is usually a dotted path; those are parsed once and cached. Anything else
+    // falls back to evaluating `return <expr>`.
     static bool GetInt(lua_State* L, const char* expr, int* out);
     static bool GetBool(lua_State* L, const char* expr, bool* out);
     static bool GetString(lua_State* L, const char* expr, std::string* out);
 
+    static bool GetInt(lua_State* L, const LuaPath& path, int* out);
+    static bool GetBool(lua_State* L, const LuaPath& path, bool* out);
+    static bool GetString(lua_State* L, const LuaPath& path, std::string* out);
+
+    // Batched read: pulls the whole `config` table (gameplay, grid, window...) into `out` in
+    // one traversal via Config::LoadFromLua, instead of one path lookup per field. Missing or
+    // mistyped fields keep their current value. False if `config` is not a table.
+    static bool ReadConfig(lua_State* L, snake::io::Config* out);
+
 private:
     static int l_log(lua_State* L);
+    static bool PushExpr(lua_State* L, const char* expr);
 };
 
 }  // namespace snake::lua
@@ -0,0 +1,159 @@
+#include "lua/ChunkCache.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include "io/Paths.h"
+
+namespace snake::lua {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'N', 'K', 'L', 'U', 'A', 'C', '1'};
+constexpr std::size_t kHeaderSize = sizeof(kMagic) + sizeof(std::uint64_t);
+
+std::uint64_t Fnv1a(std::uint64_t h, std::string_view bytes) {
+    for (const char c : bytes) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+
+bool ReadAll(const std::filesystem::path& path, std::string* out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    out->assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return !in.bad();
+}
+
+int AppendWriter(lua_State* /*L*/, const void* p, size_t sz, void* ud) {
+    static_cast<std::string*>(ud)->append(static_cast<const char*>(p), sz);
+    return 0;
+}
+
+std::filesystem::path CacheFileFor(const std::string& chunkname) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.luac",
+                  static_cast<unsigned long long>(Fnv1a(kFnvOffset, chunkname)));
+    return snake::io::UserPath("luacache") / name;
+}
+
+bool WriteCache(const std::filesystem::path& file, std::uint64_t key, const std::string& bytecode) {
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+    const std::filesystem::path tmp = file.string() + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(kMagic, sizeof(kMagic));
+        out.write(reinterpret_cast<const char*>(&key), sizeof(key));
+        out.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+        if (!out) {
+            out.close();
+            std::filesystem::remove(tmp, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(tmp, file, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int LoadChunkCached(lua_State* L, const std::filesystem::path& path, ChunkLoadInfo* info) {
+    const auto start = std::chrono::steady_clock::now();
+    ChunkLoadInfo local;
+    ChunkLoadInfo& result = info ? *info : local;
+    result = {};
+    auto finish = [&](int status) {
+        result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return status;
+    };
+
+    // Same chunk name as luaL_loadfile so error messages and tracebacks are unchanged.
+    const std::string chunkname = "@" + path.string();
+    std::string source;
+    if (!ReadAll(path, &source)) {
+        lua_pushfstring(L, "cannot open %s", path.string().c_str());
+        return finish(LUA_ERRFILE);
+    }
+
+    std::uint64_t key = Fnv1a(kFnvOffset, LUA_VERSION_RELEASE);
+    key = Fnv1a(key, chunkname);
+    key = Fnv1a(key, source);
+
+    const std::filesystem::path cache_file = CacheFileFor(chunkname);
+    std::string cached;
+    if (ReadAll(cache_file, &cached) && cached.size() > kHeaderSize &&
+        std::memcmp(cached.data(), kMagic, sizeof(kMagic)) == 0) {
+        std::uint64_t stored = 0;
+        std::memcpy(&stored, cached.data() + sizeof(kMagic), sizeof(stored));
+        if (stored == key &&
+            luaL_loadbufferx(L, cached.data() + kHeaderSize, cached.size() - kHeaderSize,
+                             chunkname.c_str(), "b") == LUA_OK) {
+            result.cache_hit = true;
+            return finish(LUA_OK);
+        }
+        if (stored == key) {
+            lua_pop(L, 1);  // corrupt entry: drop the error and recompile
+        }
+    }
+
+    const int status = luaL_loadbufferx(L, source.data(), source.size(), chunkname.c_str(), nullptr);
+    if (status != LUA_OK) {
+        return finish(status);
+    }
+
+    std::string bytecode;
+    if (lua_dump(L, &AppendWriter, &bytecode, 0) == 0) {
+        result.cache_written = WriteCache(cache_file, key, bytecode);
+    }
+    return finish(LUA_OK);
+}
+
+bool CompileChunk(const std::filesystem::path& path, CompiledChunk* out, std::string* error) {
+    lua_State* L = luaL_newstate();
+    if (!L) {
+        *error = "failed to create lua state";
+        return false;
+    }
+    bool ok = LoadChunkCached(L, path) == LUA_OK;
+    if (ok) {
+        out->chunkname = "@" + path.string();
+        out->bytecode.clear();
+        ok = lua_dump(L, &AppendWriter, &out->bytecode, 0) == 0;
+        if (!ok) {
+            *error = "lua_dump failed for " + path.string();
+        }
+    } else {
+        const char* msg = lua_tostring(L, -1);
+        *error = msg ? msg : "load failed";
+    }
+    lua_close(L);
+    return ok;
+}
+
+int LoadCompiledChunk(lua_State* L, const CompiledChunk& chunk) {
+    return luaL_loadbufferx(L, chunk.bytecode.data(), chunk.bytecode.size(), chunk.chunkname.c_str(),
+                            "b");
+}
+
+}  // namespace snake::lua
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <lua.hpp>
+
+#include <filesystem>
+#include <string>
+
+namespace snake::lua {
+
+struct ChunkLoadInfo {
+    bool cache_hit = false;      // bytecode came from the cache
+    bool cache_written = false;  // source was compiled and the cache refreshed
+    double ms = 0.0;             // total time spent in LoadChunkCached
+};
+
+// Drop-in replacement for luaL_loadfile: pushes the compiled chunk, or an error message and
+// returns the error code. Bytecode is cached in %AppData%/snake/luacache, keyed on the
+// source bytes, chunk name and Lua release; any mismatch or unreadable entry falls back to
+// compiling the source (and rewrites the entry).
+int LoadChunkCached(lua_State* L, const std::filesystem::path& path, ChunkLoadInfo* info = nullptr);
+
+// Bytecode compiled once and loaded into several states (see LuaStatePool).
+struct CompiledChunk {
+    std::string chunkname;  // "@path", as luaL_loadfile would name it
+    std::string bytecode;   // with debug info
+};
+
+// Compiles `path` (through the cache above) in a scratch state. On failure `error` gets the
+// Lua message.
+bool CompileChunk(const std::filesystem::path& path, CompiledChunk* out, std::string* error);
+
+// luaL_loadbufferx for a CompiledChunk (binary mode only).
+int LoadCompiledChunk(lua_State* L, const CompiledChunk& chunk);
+
+}  // namespace snake::lua
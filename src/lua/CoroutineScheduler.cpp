@@ -0,0 +1,191 @@
+#include "lua/CoroutineScheduler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace snake::lua {
+
+namespace {
+constexpr std::array<const char*, static_cast<std::size_t>(CoroutineScheduler::Event::Count)>
+    kEventNames{"round_start", "food_eaten", "bonus_picked", "game_over"};
+}  // namespace
+
+void CoroutineScheduler::Bind(void* owner, ResumeFn resume) {
+    owner_ = owner;
+    resume_ = resume;
+}
+
+void CoroutineScheduler::Install(lua_State* L) {
+    lua_getglobal(L, "snake");
+    if (!lua_istable(L, -1)) {
+        lua_pop(L, 1);
+        lua_newtable(L);
+        lua_pushvalue(L, -1);
+        lua_setglobal(L, "snake");
+    }
+    const std::pair<const char*, lua_CFunction> fns[] = {
+        {"spawn", &CoroutineScheduler::l_spawn},
+        {"wait_ticks", &CoroutineScheduler::l_wait_ticks},
+        {"wait_event", &CoroutineScheduler::l_wait_event},
+    };
+    for (const auto& [name, fn] : fns) {
+        lua_pushlightuserdata(L, this);
+        lua_pushcclosure(L, fn, 1);
+        lua_setfield(L, -2, name);
+    }
+    lua_pop(L, 1);
+}
+
+void CoroutineScheduler::Tick(lua_State* L) {
+    ++now_;
+    if (sleeping_ == 0) {
+        return;
+    }
+    auto& slot = wheel_[now_ & (kWheelSlots - 1)];
+    if (slot.empty()) {
+        return;
+    }
+
+    // Entries more than one wheel turn ahead share the slot and stay put.
+    std::vector<Parked> due;
+    due.swap(scratch_);
+    due.clear();
+    const auto first_due = std::stable_partition(
+        slot.begin(), slot.end(), [this](const Parked& p) { return p.due > now_; });
+    due.assign(first_due, slot.end());
+    slot.erase(first_due, slot.end());
+    sleeping_ -= due.size();
+
+    for (const Parked& p : due) {
+        Resume(L, p, 0);
+    }
+    due.clear();
+    scratch_.swap(due);
+}
+
+void CoroutineScheduler::Clear(lua_State* L) {
+    auto drop = [L](std::vector<Parked>& list) {
+        for (const Parked& p : list) {
+            luaL_unref(L, LUA_REGISTRYINDEX, p.ref);
+        }
+        list.clear();
+    };
+    for (auto& slot : wheel_) {
+        drop(slot);
+    }
+    for (auto& list : waiters_) {
+        drop(list);
+    }
+    sleeping_ = 0;
+    waiting_ = 0;
+}
+
+void CoroutineScheduler::Signal(lua_State* L, Event event, std::string_view arg) {
+    auto& list = waiters_[static_cast<std::size_t>(event)];
+    if (list.empty()) {
+        return;
+    }
+
+    // Coroutines that wait again for the same event are parked for the next signal.
+    std::vector<Parked> due;
+    due.swap(scratch_);
+    due.clear();
+    due.swap(list);
+    waiting_ -= due.size();
+
+    for (const Parked& p : due) {
+        int nargs = 0;
+        if (!arg.empty()) {
+            lua_pushlstring(p.co, arg.data(), arg.size());
+            nargs = 1;
+        }
+        Resume(L, p, nargs);
+    }
+    due.clear();
+    scratch_.swap(due);
+}
+
+std::uint64_t CoroutineScheduler::Now() const {
+    return now_;
+}
+
+std::size_t CoroutineScheduler::Sleeping() const {
+    return sleeping_;
+}
+
+std::size_t CoroutineScheduler::Waiting() const {
+    return waiting_;
+}
+
+void CoroutineScheduler::Resume(lua_State* from, Parked parked, int nargs) {
+    request_ = {};
+    running_.push_back(parked.co);
+    const int status = resume_(owner_, parked.co, from, nargs);
+    running_.pop_back();
+    const WaitRequest request = std::exchange(request_, {});
+
+    if (status != LUA_YIELD) {  // finished, or failed and already reported by the owner
+        luaL_unref(from, LUA_REGISTRYINDEX, parked.ref);
+        return;
+    }
+
+    if (request.kind == WaitKind::Event) {
+        waiters_[static_cast<std::size_t>(request.event)].push_back(parked);
+        ++waiting_;
+        return;
+    }
+    // A bare coroutine.yield() sleeps for one tick.
+    parked.due = now_ + (request.kind == WaitKind::Ticks ? request.ticks : 1);
+    wheel_[parked.due & (kWheelSlots - 1)].push_back(parked);
+    ++sleeping_;
+}
+
+CoroutineScheduler* CoroutineScheduler::Self(lua_State* L) {
+    return static_cast<CoroutineScheduler*>(lua_touserdata(L, lua_upvalueindex(1)));
+}
+
+int CoroutineScheduler::l_spawn(lua_State* L) {
+    CoroutineScheduler* self = Self(L);
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+    const int nargs = lua_gettop(L) - 1;
+
+    lua_State* co = lua_newthread(L);
+    lua_insert(L, 1);
+    lua_xmove(L, co, nargs + 1);  // function and arguments
+    lua_pushvalue(L, 1);
+    const int ref = luaL_ref(L, LUA_REGISTRYINDEX);
+
+    // Runs up to the first wait right away; returns the coroutine for coroutine.status().
+    self->Resume(L, Parked{co, ref, 0}, nargs);
+    return 1;
+}
+
+int CoroutineScheduler::l_wait_ticks(lua_State* L) {
+    CoroutineScheduler* self = Self(L);
+    if (self->running_.empty() || self->running_.back() != L) {
+        return luaL_error(L, "snake.wait_ticks must be called from a coroutine started by snake.spawn");
+    }
+    const lua_Integer n = luaL_checkinteger(L, 1);
+    self->request_.kind = WaitKind::Ticks;
+    self->request_.ticks = n < 1 ? 1 : static_cast<std::uint64_t>(n);
+    return lua_yield(L, 0);
+}
+
+int CoroutineScheduler::l_wait_event(lua_State* L) {
+    CoroutineScheduler* self = Self(L);
+    if (self->running_.empty() || self->running_.back() != L) {
+        return luaL_error(L, "snake.wait_event must be called from a coroutine started by snake.spawn");
+    }
+    const char* name = luaL_checkstring(L, 1);
+    for (std::size_t i = 0; i < kEventNames.size(); ++i) {
+        if (std::strcmp(name, kEventNames[i]) == 0) {
+            self->request_.kind = WaitKind::Event;
+            self->request_.event = static_cast<Event>(i);
+            return lua_yield(L, 0);
+        }
+    }
+    return luaL_argerror(L, 1, "expected round_start, food_eaten, bonus_picked or game_over");
+}
+
+}  // namespace snake::lua
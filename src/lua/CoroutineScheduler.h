@@ -0,0 +1,76 @@
+#pragma once
+
+#include <lua.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace snake::lua {
+
+// Runs coroutines started from Lua with snake.spawn(fn, ...) and parks them while they wait.
+// snake.wait_ticks(n) files the coroutine in a timer wheel slot, snake.wait_event(name) in a
+// per-event list; each tick only the current slot is visited, so per-tick cost follows the
+// amount of due work, not the number of sleeping scripts. One scheduler per lua_State.
+class CoroutineScheduler {
+public:
+    enum class Event : std::uint8_t { RoundStart, FoodEaten, BonusPicked, GameOver, Count };
+
+    // Resumes `co` with `nargs` values on its stack and returns the lua_resume status, with any
+    // yielded/returned values popped. The owner applies budgets/profiling and reports errors.
+    using ResumeFn = int (*)(void* owner, lua_State* co, lua_State* from, int nargs);
+
+    void Bind(void* owner, ResumeFn resume);
+    // Adds spawn, wait_ticks and wait_event to the global `snake` table (created if missing).
+    void Install(lua_State* L);
+
+    // Advances one tick and resumes the coroutines that are due.
+    void Tick(lua_State* L);
+    // Resumes coroutines waiting for `event`; `arg` (if not empty) is returned by wait_event.
+    void Signal(lua_State* L, Event event, std::string_view arg);
+
+    // Forgets every parked coroutine without resuming it; the threads become garbage.
+    void Clear(lua_State* L);
+
+    std::uint64_t Now() const;
+    std::size_t Sleeping() const;
+    std::size_t Waiting() const;
+
+private:
+    static constexpr std::size_t kWheelSlots = 256;  // power of two
+
+    struct Parked {
+        lua_State* co = nullptr;
+        int ref = LUA_NOREF;  // registry anchor for the thread
+        std::uint64_t due = 0;
+    };
+
+    enum class WaitKind : std::uint8_t { None, Ticks, Event };
+    struct WaitRequest {
+        WaitKind kind = WaitKind::None;
+        std::uint64_t ticks = 0;
+        Event event = Event::Count;
+    };
+
+    static CoroutineScheduler* Self(lua_State* L);
+    static int l_spawn(lua_State* L);
+    static int l_wait_ticks(lua_State* L);
+    static int l_wait_event(lua_State* L);
+
+    void Resume(lua_State* from, Parked parked, int nargs);
+
+    void* owner_ = nullptr;
+    ResumeFn resume_ = nullptr;
+    std::uint64_t now_ = 0;
+    std::size_t sleeping_ = 0;
+    std::size_t waiting_ = 0;
+    std::array<std::vector<Parked>, kWheelSlots> wheel_;
+    std::array<std::vector<Parked>, static_cast<std::size_t>(Event::Count)> waiters_;
+    std::vector<Parked> scratch_;        // due coroutines of the current Tick/Signal
+    std::vector<lua_State*> running_;    // coroutines being resumed, innermost last
+    WaitRequest request_;                // set by wait_* right before yielding
+};
+
+}  // namespace snake::lua
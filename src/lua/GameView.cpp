@@ -0,0 +1,204 @@
+#include "lua/GameView.h"
+
+#include "game/Game.h"
+
+#include <cstddef>
+
+namespace snake::lua {
+
+namespace {
+
+constexpr const char* kMetaName = "snake.GameView";
+
+enum class Field : int {
+    Score = 1,
+    Length,
+    Dir,
+    BoardW,
+    BoardH,
+    WrapMode,
+    GameOver,
+    SlowActive,
+    SlowMultiplier,
+    SlowRemaining,
+    FoodScore,
+    BonusScore,
+    BonusCount,
+};
+
+struct FieldName {
+    const char* name;
+    Field field;
+};
+
+constexpr FieldName kFields[] = {
+    {"score", Field::Score},
+    {"length", Field::Length},
+    {"dir", Field::Dir},
+    {"board_w", Field::BoardW},
+    {"board_h", Field::BoardH},
+    {"wrap_mode", Field::WrapMode},
+    {"game_over", Field::GameOver},
+    {"slow_active", Field::SlowActive},
+    {"slow_multiplier", Field::SlowMultiplier},
+    {"slow_remaining", Field::SlowRemaining},
+    {"food_score", Field::FoodScore},
+    {"bonus_score", Field::BonusScore},
+    {"bonus_count", Field::BonusCount},
+};
+
+const char* DirName(snake::game::Dir d) {
+    switch (d) {
+        case snake::game::Dir::Up: return "up";
+        case snake::game::Dir::Down: return "down";
+        case snake::game::Dir::Left: return "left";
+        case snake::game::Dir::Right: return "right";
+    }
+    return "right";
+}
+
+const char* BonusName(snake::game::BonusType t) {
+    return t == snake::game::BonusType::Slow ? "bonus_slow" : "bonus_score";
+}
+
+}  // namespace
+
+void GameView::Push(lua_State* L, const snake::game::Game* game) {
+    auto** slot = static_cast<const snake::game::Game**>(
+        lua_newuserdatauv(L, sizeof(const snake::game::Game*), 0));
+    *slot = game;
+
+    if (luaL_newmetatable(L, kMetaName)) {
+        // __index closes over two lookup tables: method name -> function and
+        // field name -> Field id. Both lookups hit interned strings, no allocation.
+        lua_createtable(L, 0, 3);
+        lua_pushcfunction(L, &GameView::l_segment);
+        lua_setfield(L, -2, "segment");
+        lua_pushcfunction(L, &GameView::l_food);
+        lua_setfield(L, -2, "food");
+        lua_pushcfunction(L, &GameView::l_bonus);
+        lua_setfield(L, -2, "bonus");
+
+        lua_createtable(L, 0, static_cast<int>(std::size(kFields)));
+        for (const auto& f : kFields) {
+            lua_pushinteger(L, static_cast<lua_Integer>(f.field));
+            lua_setfield(L, -2, f.name);
+        }
+        lua_pushcclosure(L, &GameView::l_index, 2);
+        lua_setfield(L, -2, "__index");
+
+        lua_pushcfunction(L, &GameView::l_newindex);
+        lua_setfield(L, -2, "__newindex");
+        lua_pushcfunction(L, &GameView::l_len);
+        lua_setfield(L, -2, "__len");
+        lua_pushcfunction(L, &GameView::l_tostring);
+        lua_setfield(L, -2, "__tostring");
+        lua_pushliteral(L, "locked");
+        lua_setfield(L, -2, "__metatable");
+    }
+    lua_setmetatable(L, -2);
+}
+
+void GameView::Unbind(lua_State* L, int idx) {
+    if (auto** slot = static_cast<const snake::game::Game**>(luaL_testudata(L, idx, kMetaName))) {
+        *slot = nullptr;
+    }
+}
+
+const snake::game::Game& GameView::Check(lua_State* L) {
+    auto** slot = static_cast<const snake::game::Game**>(luaL_checkudata(L, 1, kMetaName));
+    if (*slot == nullptr) {
+        luaL_error(L, "game view is not bound");
+    }
+    return **slot;
+}
+
+int GameView::l_index(lua_State* L) {
+    const snake::game::Game& game = Check(L);
+
+    lua_pushvalue(L, 2);
+    if (lua_rawget(L, lua_upvalueindex(1)) != LUA_TNIL) {
+        return 1;
+    }
+    lua_pop(L, 1);
+
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(2));
+    const auto field = static_cast<Field>(lua_tointeger(L, -1));
+    lua_pop(L, 1);
+
+    switch (field) {
+        case Field::Score: lua_pushinteger(L, game.GetScore().Score()); break;
+        case Field::Length: lua_pushinteger(L, game.GetSnake().Length()); break;
+        case Field::Dir: lua_pushstring(L, DirName(game.GetSnake().Direction())); break;
+        case Field::BoardW: lua_pushinteger(L, game.GetBoard().W()); break;
+        case Field::BoardH: lua_pushinteger(L, game.GetBoard().H()); break;
+        case Field::WrapMode: lua_pushboolean(L, game.WrapMode()); break;
+        case Field::GameOver: lua_pushboolean(L, game.IsGameOver()); break;
+        case Field::SlowActive: lua_pushboolean(L, game.GetEffects().SlowActive()); break;
+        case Field::SlowMultiplier: lua_pushnumber(L, game.GetEffects().SlowMultiplier()); break;
+        case Field::SlowRemaining: lua_pushnumber(L, game.GetEffects().SlowRemaining()); break;
+        case Field::FoodScore: lua_pushinteger(L, game.FoodScore()); break;
+        case Field::BonusScore: lua_pushinteger(L, game.BonusScore()); break;
+        case Field::BonusCount: lua_pushinteger(L, game.GetSpawner().BonusCount()); break;
+        default: lua_pushnil(L); break;
+    }
+    return 1;
+}
+
+int GameView::l_newindex(lua_State* L) {
+    return luaL_error(L, "game view is read-only (field '%s')", luaL_tolstring(L, 2, nullptr));
+}
+
+int GameView::l_len(lua_State* L) {
+    lua_pushinteger(L, Check(L).GetSnake().Length());
+    return 1;
+}
+
+int GameView::l_tostring(lua_State* L) {
+    const snake::game::Game& game = Check(L);
+    lua_pushfstring(L, "GameView(score=%d, length=%d)", game.GetScore().Score(),
+                    game.GetSnake().Length());
+    return 1;
+}
+
+int GameView::l_segment(lua_State* L) {
+    const auto& body = Check(L).GetSnake().Body();
+    const lua_Integer i = luaL_checkinteger(L, 2);
+    if (i < 1 || i > static_cast<lua_Integer>(body.size())) {
+        lua_pushnil(L);
+        return 1;
+    }
+    const snake::game::Pos p = body[static_cast<std::size_t>(i - 1)];
+    lua_pushinteger(L, p.x);
+    lua_pushinteger(L, p.y);
+    return 2;
+}
+
+int GameView::l_food(lua_State* L) {
+    const auto& spawner = Check(L).GetSpawner();
+    if (!spawner.HasFood()) {
+        lua_pushnil(L);
+        return 1;
+    }
+    const snake::game::Pos p = spawner.FoodPos();
+    lua_pushinteger(L, p.x);
+    lua_pushinteger(L, p.y);
+    return 2;
+}
+
+int GameView::l_bonus(lua_State* L) {
+    const auto& bonuses = Check(L).GetSpawner().Bonuses();
+    const lua_Integer i = luaL_checkinteger(L, 2);
+    if (i < 1 || i > static_cast<lua_Integer>(bonuses.size())) {
+        lua_pushnil(L);
+        return 1;
+    }
+    const snake::game::Bonus& b = bonuses[static_cast<std::size_t>(i - 1)];
+    lua_pushstring(L, BonusName(b.type));
+    lua_pushinteger(L, b.pos.x);
+    lua_pushinteger(L, b.pos.y);
+    return 3;
+}
+
+}  // namespace snake::lua
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <lua.hpp>
+
+namespace snake::game {
+class Game;
+}
+
+namespace snake::lua {
+
+// Read-only typed userdata over a live Game. Fields are read straight from C++ memory on
+// access, so hooks pay O(1) per field they touch and nothing is marshalled per tick.
+//
+//   ctx.score, ctx.length, ctx.dir, ctx.board_w, ctx.board_h, ctx.wrap_mode,
+//   ctx.game_over, ctx.slow_active, ctx.slow_multiplier, ctx.slow_remaining,
+//   ctx.food_score, ctx.bonus_score, ctx.bonus_count, #ctx (== ctx.length)
+//   ctx:segment(i) -> x, y   (1 = head; nil if out of range)
+//   ctx:food()     -> x, y   (nil if there is no food)
+//   ctx:bonus(i)   -> type, x, y
+class GameView {
+public:
+    // Creates a view userdata for `game` and pushes it. The metatable is shared per state.
+    static void Push(lua_State* L, const snake::game::Game* game);
+    // Detaches the view at `idx` from its Game (no-op for other values). Copies scripts kept
+    // in globals or parked coroutines then raise "game view is not bound" instead of reading
+    // a Game that may no longer exist.
+    static void Unbind(lua_State* L, int idx);
+
+private:
+    static const snake::game::Game& Check(lua_State* L);
+    static int l_index(lua_State* L);
+    static int l_newindex(lua_State* L);
+    static int l_len(lua_State* L);
+    static int l_tostring(lua_State* L);
+    static int l_segment(lua_State* L);
+    static int l_food(lua_State* L);
+    static int l_bonus(lua_State* L);
+};
+
+}  // namespace snake::lua
@@ -0,0 +1,112 @@
+#include "lua/LuaAllocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace snake::lua {
+
+LuaPoolAllocator::~LuaPoolAllocator() {
+    for (void* chunk : chunks_) {
+        std::free(chunk);
+    }
+}
+
+int LuaPoolAllocator::ClassOf(std::size_t size) {
+    if (size == 0 || size > kMaxPooled) {
+        return -1;
+    }
+    // Sizes are tiny and the table is short; a linear scan beats a lookup table in cache.
+    for (std::size_t i = 0; i < kClassSizes.size(); ++i) {
+        if (size <= kClassSizes[i]) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void LuaPoolAllocator::Refill(int cls) {
+    void* chunk = std::malloc(kChunkBytes);
+    if (chunk == nullptr) {
+        return;
+    }
+    chunks_.push_back(chunk);
+
+    const std::size_t block = kClassSizes[static_cast<std::size_t>(cls)];
+    const std::size_t count = kChunkBytes / block;
+    auto* base = static_cast<unsigned char*>(chunk);
+    FreeBlock* head = free_[static_cast<std::size_t>(cls)];
+    for (std::size_t i = count; i-- > 0;) {
+        auto* b = reinterpret_cast<FreeBlock*>(base + i * block);
+        b->next = head;
+        head = b;
+    }
+    free_[static_cast<std::size_t>(cls)] = head;
+}
+
+void* LuaPoolAllocator::AllocateFromClass(int cls) {
+    FreeBlock*& head = free_[static_cast<std::size_t>(cls)];
+    if (head == nullptr) {
+        Refill(cls);
+        if (head == nullptr) {
+            return nullptr;
+        }
+    }
+    FreeBlock* b = head;
+    head = b->next;
+    return b;
+}
+
+void LuaPoolAllocator::FreeToClass(void* ptr, int cls) {
+    auto* b = static_cast<FreeBlock*>(ptr);
+    b->next = free_[static_cast<std::size_t>(cls)];
+    free_[static_cast<std::size_t>(cls)] = b;
+}
+
+void* LuaPoolAllocator::Realloc(void* ptr, std::size_t osize, std::size_t nsize) {
+    const int old_cls = ptr != nullptr ? ClassOf(osize) : -1;
+
+    if (nsize == 0) {
+        if (ptr != nullptr) {
+            if (old_cls >= 0) {
+                FreeToClass(ptr, old_cls);
+            } else {
+                std::free(ptr);
+            }
+        }
+        return nullptr;
+    }
+
+    const int new_cls = ClassOf(nsize);
+    if (ptr == nullptr) {
+        return new_cls >= 0 ? AllocateFromClass(new_cls) : std::malloc(nsize);
+    }
+    if (old_cls == new_cls && old_cls >= 0) {
+        return ptr;  // still fits its slot
+    }
+    if (old_cls < 0 && new_cls < 0) {
+        return std::realloc(ptr, nsize);
+    }
+
+    void* fresh = new_cls >= 0 ? AllocateFromClass(new_cls) : std::malloc(nsize);
+    if (fresh == nullptr) {
+        return nullptr;  // Lua keeps the old block on failure
+    }
+    std::memcpy(fresh, ptr, std::min(osize, nsize));
+    if (old_cls >= 0) {
+        FreeToClass(ptr, old_cls);
+    } else {
+        std::free(ptr);
+    }
+    return fresh;
+}
+
+std::size_t LuaPoolAllocator::PooledBytes() const {
+    return chunks_.size() * kChunkBytes;
+}
+
+std::size_t LuaPoolAllocator::ChunkCount() const {
+    return chunks_.size();
+}
+
+}  // namespace snake::lua
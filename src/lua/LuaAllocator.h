@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace snake::lua {
+
+// lua_Alloc backend for one lua_State. Small blocks (most Lua strings, tables, closures and
+// upvalues) come from 16-byte-aligned size-class free lists carved out of 64 KB chunks, so
+// steady-state hook allocations never reach malloc. Larger blocks fall through to malloc/realloc.
+// Not thread-safe; a state is only ever used by one thread at a time.
+class LuaPoolAllocator {
+public:
+    LuaPoolAllocator() = default;
+    ~LuaPoolAllocator();
+    LuaPoolAllocator(const LuaPoolAllocator&) = delete;
+    LuaPoolAllocator& operator=(const LuaPoolAllocator&) = delete;
+
+    // Same contract as lua_Alloc (osize is the old block size when ptr != nullptr).
+    void* Realloc(void* ptr, std::size_t osize, std::size_t nsize);
+
+    std::size_t PooledBytes() const;  // bytes reserved in chunks
+    std::size_t ChunkCount() const;
+
+private:
+    static constexpr std::size_t kChunkBytes = 64 * 1024;
+    static constexpr std::array<std::size_t, 10> kClassSizes{16, 32, 48, 64, 80, 96, 128, 160, 192, 256};
+    static constexpr std::size_t kMaxPooled = kClassSizes.back();
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static int ClassOf(std::size_t size);  // -1 if not pooled
+    void* AllocateFromClass(int cls);
+    void FreeToClass(void* ptr, int cls);
+    void Refill(int cls);
+
+    std::array<FreeBlock*, kClassSizes.size()> free_{};
+    std::vector<void*> chunks_;
+};
+
+}  // namespace snake::lua
@@ -0,0 +1,128 @@
+#include "lua/LuaProfiler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace snake::lua {
+
+double LuaCallStats::AvgMs() const {
+    return calls > 0 ? total_ms / static_cast<double>(calls) : 0.0;
+}
+
+double LuaCallStats::P99Ms() const {
+    const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(calls, kSampleCount));
+    if (n == 0) {
+        return 0.0;
+    }
+    std::array<float, kSampleCount> sorted = samples_ms;
+    const std::size_t idx = std::min(n - 1, (n * 99) / 100);
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(idx),
+                     sorted.begin() + static_cast<std::ptrdiff_t>(n));
+    return sorted[idx];
+}
+
+void LuaProfiler::Record(std::string_view where, const CallResult& result) {
+    auto it = stats_.find(where);
+    if (it == stats_.end()) {
+        it = stats_.emplace(std::string(where), LuaCallStats{}).first;
+    }
+    LuaCallStats& s = it->second;
+    ++s.calls;
+    s.total_ms += result.ms;
+    s.max_ms = std::max(s.max_ms, result.ms);
+    s.alloc_count += result.alloc_count;
+    s.alloc_bytes += result.alloc_bytes;
+    if (result.error) {
+        ++s.errors;
+    }
+    if (result.budget_abort) {
+        ++s.budget_aborts;
+    }
+    s.samples_ms[s.next_sample] = static_cast<float>(result.ms);
+    s.next_sample = (s.next_sample + 1) % LuaCallStats::kSampleCount;
+}
+
+void LuaProfiler::Reset() {
+    stats_.clear();
+}
+
+bool LuaProfiler::Empty() const {
+    return stats_.empty();
+}
+
+std::vector<std::pair<std::string, LuaCallStats>> LuaProfiler::Sorted() const {
+    std::vector<std::pair<std::string, LuaCallStats>> rows(stats_.begin(), stats_.end());
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return a.second.total_ms > b.second.total_ms;
+    });
+    return rows;
+}
+
+std::vector<std::string> LuaProfiler::OverlayLines(std::size_t max_rows) const {
+    std::vector<std::string> lines;
+    lines.push_back("LUA PROFILE (calls / avg / p99 / max ms / allocs)");
+    const auto rows = Sorted();
+    if (rows.empty()) {
+        lines.push_back("No Lua calls yet");
+        return lines;
+    }
+    char buf[160];
+    for (std::size_t i = 0; i < rows.size() && i < max_rows; ++i) {
+        const auto& [where, s] = rows[i];
+        std::snprintf(buf,
+                      sizeof(buf),
+                      "%s: %llu / %.3f / %.3f / %.3f / %.1f",
+                      where.c_str(),
+                      static_cast<unsigned long long>(s.calls),
+                      s.AvgMs(),
+                      s.P99Ms(),
+                      s.max_ms,
+                      s.calls > 0 ? static_cast<double>(s.alloc_count) / static_cast<double>(s.calls) : 0.0);
+        lines.emplace_back(buf);
+        if (s.errors > 0 || s.budget_aborts > 0) {
+            std::snprintf(buf,
+                          sizeof(buf),
+                          "  errors %llu, budget aborts %llu",
+                          static_cast<unsigned long long>(s.errors),
+                          static_cast<unsigned long long>(s.budget_aborts));
+            lines.emplace_back(buf);
+        }
+    }
+    return lines;
+}
+
+void LuaProfiler::WriteReport(std::ostream& out) const {
+    char buf[256];
+    std::snprintf(buf,
+                  sizeof(buf),
+                  "%-28s %10s %12s %10s %10s %10s %12s %12s %8s %8s\n",
+                  "call site",
+                  "calls",
+                  "total ms",
+                  "avg ms",
+                  "p99 ms",
+                  "max ms",
+                  "allocs",
+                  "alloc bytes",
+                  "errors",
+                  "budget");
+    out << buf;
+    for (const auto& [where, s] : Sorted()) {
+        std::snprintf(buf,
+                      sizeof(buf),
+                      "%-28s %10llu %12.3f %10.4f %10.4f %10.4f %12llu %12llu %8llu %8llu\n",
+                      where.c_str(),
+                      static_cast<unsigned long long>(s.calls),
+                      s.total_ms,
+                      s.AvgMs(),
+                      s.P99Ms(),
+                      s.max_ms,
+                      static_cast<unsigned long long>(s.alloc_count),
+                      static_cast<unsigned long long>(s.alloc_bytes),
+                      static_cast<unsigned long long>(s.errors),
+                      static_cast<unsigned long long>(s.budget_aborts));
+        out << buf;
+    }
+}
+
+}  // namespace snake::lua
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace snake::lua {
+
+// Per-call-site statistics for Lua calls made through LuaRuntime::PCall.
+struct LuaCallStats {
+    static constexpr std::size_t kSampleCount = 512;
+
+    std::uint64_t calls = 0;
+    std::uint64_t errors = 0;
+    std::uint64_t budget_aborts = 0;
+    double total_ms = 0.0;
+    double max_ms = 0.0;
+    std::uint64_t alloc_count = 0;
+    std::uint64_t alloc_bytes = 0;
+    // Ring of the most recent durations, used for percentiles.
+    std::array<float, kSampleCount> samples_ms{};
+    std::size_t next_sample = 0;
+
+    double AvgMs() const;
+    double P99Ms() const;
+};
+
+class LuaProfiler {
+public:
+    struct CallResult {
+        double ms = 0.0;
+        std::uint64_t alloc_count = 0;
+        std::uint64_t alloc_bytes = 0;
+        bool error = false;
+        bool budget_abort = false;
+    };
+
+    void Record(std::string_view where, const CallResult& result);
+    void Reset();
+    bool Empty() const;
+
+    // Call sites sorted by total time, most expensive first.
+    std::vector<std::pair<std::string, LuaCallStats>> Sorted() const;
+    // Short lines for the debug overlay (top `max_rows` call sites).
+    std::vector<std::string> OverlayLines(std::size_t max_rows) const;
+    void WriteReport(std::ostream& out) const;
+
+private:
+    struct StringHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::unordered_map<std::string, LuaCallStats, StringHash, std::equal_to<>> stats_;
+};
+
+}  // namespace snake::lua
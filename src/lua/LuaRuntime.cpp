@@ -4,40 +4,177 @@
 
 #include <SDL.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
 #include <utility>
 
+#include "io/Config.h"
 #include "lua/Bindings.h"
+#include "lua/ChunkCache.h"
+#include "lua/GameView.h"
 
 namespace snake::lua {
 
 namespace {
 constexpr const char* kRulesChunk = "rules";
 constexpr const char* kConfigChunk = "config";
+
+constexpr int kGcStepKb = 8;                           // work per LUA_GCSTEP
+constexpr std::size_t kGcSlackBytes = 64 * 1024;       // growth before a new cycle starts
+constexpr std::size_t kGcEmergencyBytes = 4 * 1024 * 1024;
+constexpr int kGcMaxEmergencySteps = 256;
+
+constexpr std::array<const char*, static_cast<std::size_t>(Hook::Count)> kHookNames{
+    "on_app_init",
+    "on_round_start",
+    "on_tick_begin",
+    "on_tick_end",
+    "on_food_eaten",
+    "on_bonus_picked",
+    "on_game_over",
+    "on_setting_changed",
+    "on_events",
+};
+
+constexpr std::array<const char*, static_cast<std::size_t>(Hook::Count)> kHookWhere{
+    "pcall:on_app_init",
+    "pcall:on_round_start",
+    "pcall:on_tick_begin",
+    "pcall:on_tick_end",
+    "pcall:on_food_eaten",
+    "pcall:on_bonus_picked",
+    "pcall:on_game_over",
+    "pcall:on_setting_changed",
+    "pcall:on_events",
+};
+
+constexpr std::array<const char*, 2> kGameEventNames{
+    "food_eaten",
+    "bonus_picked",
+};
+
+constexpr int kEventReserve = 64;  // initial capacity of the batch, C++ and Lua side
+
+std::uint32_t HookBit(Hook hook) {
+    return 1u << static_cast<std::uint32_t>(hook);
+}
+
+int AppendDump(lua_State* /*L*/, const void* p, size_t sz, void* ud) {
+    static_cast<std::string*>(ud)->append(static_cast<const char*>(p), sz);
+    return 0;
+}
+
+bool ReadDumpSize(const std::string& bytes, std::size_t* pos, std::size_t* out) {
+    std::size_t value = 0;
+    while (*pos < bytes.size()) {
+        const auto b = static_cast<unsigned char>(bytes[(*pos)++]);
+        value = (value << 7) | (b & 0x7f);
+        if ((b & 0x80) != 0) {
+            *out = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// True if the function on top of the stack compiles to a single instruction (the
+// implicit return), i.e. `function on_tick_begin(ctx) end`. Parses the stripped
+// Lua 5.4 binary chunk header; any other layout is conservatively treated as non-empty.
+bool IsEmptyLuaFunction(lua_State* L) {
+#if LUA_VERSION_NUM == 504
+    if (lua_iscfunction(L, -1)) {
+        return false;
+    }
+    std::string bytes;
+    if (lua_dump(L, &AppendDump, &bytes, 1) != 0) {
+        return false;
+    }
+
+    constexpr std::size_t kSignatureAndVersion = 4 + 1 + 1 + 6;  // "\x1bLua", version, format, LUAC_DATA
+    if (bytes.size() < kSignatureAndVersion + 3 || static_cast<unsigned char>(bytes[4]) != 0x54) {
+        return false;
+    }
+    std::size_t pos = kSignatureAndVersion;
+    pos += 1;  // sizeof(Instruction)
+    const auto int_size = static_cast<unsigned char>(bytes[pos++]);
+    const auto num_size = static_cast<unsigned char>(bytes[pos++]);
+    pos += int_size + num_size;  // LUAC_INT, LUAC_NUM
+    pos += 1;                    // number of upvalues of the main closure
+
+    std::size_t source_size = 0;
+    std::size_t line_defined = 0;
+    std::size_t last_line_defined = 0;
+    std::size_t code_size = 0;
+    if (!ReadDumpSize(bytes, &pos, &source_size)) {
+        return false;
+    }
+    if (source_size > 0) {
+        pos += source_size - 1;
+    }
+    if (!ReadDumpSize(bytes, &pos, &line_defined) || !ReadDumpSize(bytes, &pos, &last_line_defined)) {
+        return false;
+    }
+    pos += 3;  // numparams, is_vararg, maxstacksize
+    if (!ReadDumpSize(bytes, &pos, &code_size)) {
+        return false;
+    }
+    return code_size == 1;
+#else
+    (void)L;
+    return false;
+#endif
+}
 }  // namespace
 
-LuaRuntime::LuaRuntime() = default;
+LuaRuntime::LuaRuntime() {
+    hook_refs_.fill(LUA_NOREF);
+    queued_events_.resize(kEventReserve);
+}
 
 LuaRuntime::~LuaRuntime() {
     Shutdown();
 }
 
-bool LuaRuntime::Init() {
+bool LuaRuntime::Init(bool manual_gc) {
     Shutdown();
-    L_ = luaL_newstate();
+    state_stats_ = std::make_unique<StateStats>();
+    L_ = lua_newstate(&LuaRuntime::Alloc, state_stats_.get());
     if (!L_) {
         SetError("init", "failed to create lua state");
         return false;
     }
+    lua_atpanic(L_, &LuaRuntime::Panic);
     luaL_openlibs(L_);
+    scheduler_ = std::make_unique<CoroutineScheduler>();
+    scheduler_->Bind(this, &LuaRuntime::ResumeCoroutine);
+    manual_gc_ = manual_gc;
+    lua_gc(L_, LUA_GCINC, 0, 0, 0);
+    if (manual_gc_) {
+        lua_gc(L_, LUA_GCSTOP);  // driven only by StepGc
+    }
     last_error_.reset();
     return true;
 }
 
 void LuaRuntime::Shutdown() {
+    if (reload_future_.valid()) {
+        reload_future_.wait();
+        reload_future_ = {};
+    }
+    hook_refs_.fill(LUA_NOREF);
+    hook_mask_ = 0;
+    ctx_ref_ = LUA_NOREF;
+    events_ref_ = LUA_NOREF;
+    event_pool_ref_ = LUA_NOREF;
+    events_sent_ = 0;
+    ClearEventBatch();
     if (L_) {
         lua_close(L_);
         L_ = nullptr;
     }
+    scheduler_.reset();
 }
 
 bool LuaRuntime::IsReady() const {
@@ -54,14 +191,74 @@ void LuaRuntime::ClearLastError() {
 
 bool LuaRuntime::LoadRules(const std::filesystem::path& rules_path) {
     if (!IsReady()) return false;
-    return LoadFile(rules_path, "loadfile:rules.lua");
+    scheduler_->Install(L_);
+    return FinishRulesLoad(LoadFile(rules_path, "loadfile:rules.lua"));
+}
+
+bool LuaRuntime::LoadRules(const CompiledChunk& rules) {
+    if (!IsReady()) return false;
+    scheduler_->Install(L_);
+    return FinishRulesLoad(LoadCompiled(rules, "loadfile:rules.lua"));
 }
 
-bool LuaRuntime::LoadConfig(const std::filesystem::path& config_path) {
+bool LuaRuntime::LoadConfig(const std::filesystem::path& config_path, snake::io::Config* out) {
     if (!IsReady()) return false;
 
+    const auto start = std::chrono::steady_clock::now();
     const int top_before = lua_gettop(L_);
-    if (!LoadFile(config_path, "loadfile:config.lua")) {
+    const bool ok = PublishConfig(top_before, LoadFile(config_path, "loadfile:config.lua"));
+    if (out) {
+        out->LoadFromLua(L_);
+        SDL_Log("Lua config + typed config: %.2f ms (one parse)",
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                    .count());
+    }
+    return ok;
+}
+
+bool LuaRuntime::LoadConfig(const CompiledChunk& config) {
+    if (!IsReady()) return false;
+    const int top_before = lua_gettop(L_);
+    return PublishConfig(top_before, LoadCompiled(config, "loadfile:config.lua"));
+}
+
+bool LuaRuntime::LoadScripts(const std::filesystem::path& config_path,
+                             const std::filesystem::path& rules_path,
+                             snake::io::Config* typed_config,
+                             const std::function<bool()>& want_rules) {
+    if (!IsReady()) return false;
+    const bool config_ok = LoadConfig(config_path, typed_config);
+    std::optional<LuaError> config_error = config_ok ? std::nullopt : last_error_;
+    if (want_rules && !want_rules()) {
+        return config_ok;
+    }
+    return FinishScriptsLoad(config_ok, LoadRules(rules_path), std::move(config_error));
+}
+
+bool LuaRuntime::LoadScripts(const CompiledChunk& config, const CompiledChunk& rules) {
+    if (!IsReady()) return false;
+    const bool config_ok = LoadConfig(config);
+    std::optional<LuaError> config_error = config_ok ? std::nullopt : last_error_;
+    return FinishScriptsLoad(config_ok, LoadRules(rules), std::move(config_error));
+}
+
+bool LuaRuntime::FinishScriptsLoad(bool config_ok, bool rules_ok, std::optional<LuaError> config_error) {
+    if (!config_ok) {
+        last_error_ = std::move(config_error);  // the root cause when both fail
+    }
+    return config_ok && rules_ok;
+}
+
+bool LuaRuntime::FinishRulesLoad(bool ok) {
+    BindGameView();
+    ResolveHooks();
+    ResetSpeedCache();
+    ReadBonusSpawn();
+    return ok;
+}
+
+bool LuaRuntime::PublishConfig(int top_before, bool loaded) {
+    if (!loaded) {
         return false;
     }
 
@@ -71,6 +268,7 @@ bool LuaRuntime::LoadConfig(const std::filesystem::path& config_path) {
     }
 
     lua_settop(L_, top_before);
+    ResetSpeedCache();
 
     lua_getglobal(L_, "config");
     if (lua_isnil(L_, -1)) {
@@ -83,83 +281,267 @@ bool LuaRuntime::LoadConfig(const std::filesystem::path& config_path) {
     return true;
 }
 
-bool LuaRuntime::CallVoid(std::string_view fn) {
-    if (!IsReady()) return false;
-    lua_getglobal(L_, std::string(fn).c_str());
-    if (lua_isnil(L_, -1)) {
-        lua_pop(L_, 1);
-        return true;
+bool LuaRuntime::HasHook(Hook hook) const {
+    return (hook_mask_ & HookBit(hook)) != 0;
+}
+
+void LuaRuntime::SetGame(const snake::game::Game* game) {
+    game_ = game;
+    BindGameView();
+}
+
+void LuaRuntime::DropCoroutines() {
+    if (IsReady()) {
+        scheduler_->Clear(L_);
     }
-    return PCall(0, 0, std::string("pcall:").append(fn));
 }
 
-bool LuaRuntime::CallWithCtx(std::string_view fn, void* ctx_ptr) {
-    if (!IsReady()) return false;
-    lua_getglobal(L_, std::string(fn).c_str());
-    if (lua_isnil(L_, -1)) {
-        lua_pop(L_, 1);
-        return true;
+bool LuaRuntime::CallHook(Hook hook) {
+    if (hook == Hook::TickBegin && IsReady()) {
+        scheduler_->Tick(L_);
+    }
+    bool ok = IsReady();
+    if (PushHook(hook)) {
+        ok = CallPushedHook(hook, 1);
     }
-    lua_pushlightuserdata(L_, ctx_ptr);
-    return PCall(1, 0, std::string("pcall:").append(fn));
+    WakeCoroutines(hook, {});
+    return ok;
 }
 
-bool LuaRuntime::CallWithCtxIfExists(std::string_view fn, void* ctx_ptr) {
-    if (!IsReady()) return false;
-    lua_getglobal(L_, std::string(fn).c_str());
-    if (!lua_isfunction(L_, -1)) {
-        lua_pop(L_, 1);
-        return true;
+bool LuaRuntime::CallHook(Hook hook, std::string_view arg1) {
+    bool ok = IsReady();
+    if (PushHook(hook)) {
+        lua_pushlstring(L_, arg1.data(), arg1.size());
+        ok = CallPushedHook(hook, 2);
     }
-    lua_pushlightuserdata(L_, ctx_ptr);
-    return PCall(1, 0, std::string("pcall:").append(fn));
+    WakeCoroutines(hook, arg1);
+    return ok;
 }
 
-bool LuaRuntime::CallWithCtxIfExists(std::string_view fn, void* ctx_ptr, std::string_view arg1) {
-    if (!IsReady()) return false;
-    lua_getglobal(L_, std::string(fn).c_str());
-    if (!lua_isfunction(L_, -1)) {
-        lua_pop(L_, 1);
-        return true;
+void LuaRuntime::WakeCoroutines(Hook hook, std::string_view arg) {
+    if (!IsReady() || scheduler_->Waiting() == 0) {
+        return;
+    }
+    using Event = CoroutineScheduler::Event;
+    switch (hook) {
+        case Hook::RoundStart: scheduler_->Signal(L_, Event::RoundStart, arg); break;
+        case Hook::FoodEaten: scheduler_->Signal(L_, Event::FoodEaten, arg); break;
+        case Hook::BonusPicked: scheduler_->Signal(L_, Event::BonusPicked, arg); break;
+        case Hook::GameOver: scheduler_->Signal(L_, Event::GameOver, arg); break;
+        default: break;
     }
-    lua_pushlightuserdata(L_, ctx_ptr);
-    lua_pushlstring(L_, arg1.data(), arg1.size());
-    return PCall(2, 0, std::string("pcall:").append(fn));
 }
 
-bool LuaRuntime::HotReload(const std::filesystem::path& rules_path,
-                           const std::filesystem::path& config_path) {
-    LuaRuntime tmp;
-    if (!tmp.Init()) {
-        SetError("reload:init", "failed to init temp lua state");
+bool LuaRuntime::PushHook(Hook hook) {
+    if (!IsReady() || !HasHook(hook)) {
         return false;
     }
+    lua_rawgeti(L_, LUA_REGISTRYINDEX, hook_refs_[static_cast<std::size_t>(hook)]);
+    lua_rawgeti(L_, LUA_REGISTRYINDEX, ctx_ref_);  // nil when no game is bound
+    return true;
+}
 
-    Bindings::Register(tmp.L());
+bool LuaRuntime::CallPushedHook(Hook hook, int nargs) {
+    return PCall(nargs, 0, kHookWhere[static_cast<std::size_t>(hook)]);
+}
+
+void LuaRuntime::QueueTick(std::int64_t tick) {
+    if (!HasHook(Hook::Events)) {
+        return;
+    }
+    if (queued_ticks_ == 0) {
+        queued_first_tick_ = tick;
+    }
+    queued_last_tick_ = tick;
+    ++queued_ticks_;
+}
 
-    if (!tmp.LoadRules(rules_path)) {
-        last_error_ = tmp.last_error_;
+void LuaRuntime::QueueEvent(GameEvent type, std::int64_t tick, std::string_view detail) {
+    if (!HasHook(Hook::Events)) {
+        return;
+    }
+    if (queued_count_ == queued_events_.size()) {
+        queued_events_.resize(queued_events_.size() * 2);
+    }
+    QueuedEvent& e = queued_events_[queued_count_++];
+    e.type = type;
+    e.tick = tick;
+    e.detail.assign(detail.data(), detail.size());
+}
+
+bool LuaRuntime::FlushEvents() {
+    if ((queued_ticks_ == 0 && queued_count_ == 0) || !PushHook(Hook::Events)) {
+        ClearEventBatch();
+        return IsReady();
+    }
+    PushEventBatch();
+    ClearEventBatch();
+    return CallPushedHook(Hook::Events, 2);
+}
+
+bool LuaRuntime::HotReload(const std::filesystem::path& rules_path,
+                           const std::filesystem::path& config_path) {
+    std::unique_ptr<LuaRuntime> next = BuildReloadState(rules_path, config_path, game_, manual_gc_);
+    if (next->last_error_) {
+        last_error_ = next->last_error_;
         return false;
     }
-    if (!tmp.LoadConfig(config_path)) {
-        last_error_ = tmp.last_error_;
+    AdoptState(*next);
+    return true;
+}
+
+bool LuaRuntime::BeginHotReload(const std::filesystem::path& rules_path,
+                                const std::filesystem::path& config_path) {
+    if (HotReloadPending()) {
         return false;
     }
+    const bool manual_gc = manual_gc_;
+    reload_future_ = std::async(std::launch::async, [rules_path, config_path, game = game_, manual_gc]() {
+        const auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<LuaRuntime> next = BuildReloadState(rules_path, config_path, game, manual_gc);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        SDL_Log("Lua reload prepared in %.1f ms (%s)",
+                std::chrono::duration<double, std::milli>(elapsed).count(),
+                next->last_error_ ? "failed" : "ok");
+        return next;
+    });
+    return true;
+}
+
+ReloadStatus LuaRuntime::PollHotReload() {
+    if (!reload_future_.valid()) {
+        return ReloadStatus::Idle;
+    }
+    if (reload_future_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return ReloadStatus::Pending;
+    }
+    std::unique_ptr<LuaRuntime> next = reload_future_.get();
+    if (next->last_error_) {
+        SetError(next->last_error_->where, next->last_error_->message);
+        return ReloadStatus::Failed;
+    }
+    AdoptState(*next);
+    return ReloadStatus::Applied;
+}
+
+bool LuaRuntime::HotReloadPending() const {
+    return reload_future_.valid();
+}
+
+std::unique_ptr<snake::io::Config> LuaRuntime::TakeReloadedConfig() {
+    return std::move(reloaded_config_);
+}
+
+std::unique_ptr<LuaRuntime> LuaRuntime::BuildReloadState(const std::filesystem::path& rules_path,
+                                                         const std::filesystem::path& config_path,
+                                                         const snake::game::Game* game,
+                                                         bool manual_gc) {
+    auto next = std::make_unique<LuaRuntime>();
+    next->game_ = game;
+    if (!next->Init(manual_gc)) {
+        next->SetError("reload:init", "failed to init temp lua state");
+        return next;
+    }
+
+    Bindings::Register(next->L());
 
-    std::swap(L_, tmp.L_);
+    next->reloaded_config_ = std::make_unique<snake::io::Config>();
+    next->LoadScripts(config_path, rules_path, next->reloaded_config_.get());
+    return next;
+}
+
+void LuaRuntime::AdoptState(LuaRuntime& next) {
+    std::swap(L_, next.L_);
+    std::swap(state_stats_, next.state_stats_);
+    std::swap(scheduler_, next.scheduler_);
+    scheduler_->Bind(this, &LuaRuntime::ResumeCoroutine);
+    if (next.scheduler_) {
+        next.scheduler_->Bind(&next, &LuaRuntime::ResumeCoroutine);
+    }
+    std::swap(hook_refs_, next.hook_refs_);
+    std::swap(hook_mask_, next.hook_mask_);
+    std::swap(ctx_ref_, next.ctx_ref_);
+    std::swap(speed_cache_, next.speed_cache_);
+    std::swap(speed_impure_, next.speed_impure_);
+    std::swap(bonus_spawn_, next.bonus_spawn_);
+    std::swap(events_ref_, next.events_ref_);
+    std::swap(event_pool_ref_, next.event_pool_ref_);
+    std::swap(events_sent_, next.events_sent_);
+    reloaded_config_ = std::move(next.reloaded_config_);
     last_error_.reset();
-    return true;
+    last_logged_error_.clear();
 }
 
 lua_State* LuaRuntime::L() const {
     return L_;
 }
 
+const LuaProfiler& LuaRuntime::Profiler() const {
+    return profiler_;
+}
+
+void LuaRuntime::ResetProfiler() {
+    profiler_.Reset();
+}
+
+std::size_t LuaRuntime::HeapBytes() const {
+    return state_stats_ ? state_stats_->in_use : 0;
+}
+
+void LuaRuntime::StepGc(double budget_sec) {
+    if (!IsReady() || !manual_gc_) {
+        return;
+    }
+    StateStats& stats = *state_stats_;
+    const bool over_limit = stats.in_use > std::max(stats.gc_live_bytes * 2, kGcEmergencyBytes);
+    if (!stats.gc_cycle_running && !over_limit && stats.in_use < stats.gc_live_bytes + kGcSlackBytes) {
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(budget_sec));
+    int steps = 0;
+    stats.gc_cycle_running = true;
+    while (true) {
+        ++steps;
+        if (lua_gc(L_, LUA_GCSTEP, kGcStepKb) != 0) {
+            stats.gc_cycle_running = false;
+            stats.gc_live_bytes = stats.in_use;
+            break;
+        }
+        if (std::chrono::steady_clock::now() >= deadline &&
+            !(over_limit && steps < kGcMaxEmergencySteps)) {
+            break;
+        }
+    }
+
+    LuaProfiler::CallResult result;
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    profiler_.Record("gc:step", result);
+}
+
+void LuaRuntime::SetInstructionBudget(int instructions) {
+    instruction_budget_ = std::max(0, instructions);
+}
+
+int LuaRuntime::InstructionBudget() const {
+    return instruction_budget_;
+}
+
 bool LuaRuntime::GetBaseTicksPerSec(int score, double* out_ticks_per_sec) {
     if (!IsReady() || out_ticks_per_sec == nullptr) {
         return false;
     }
 
+    if (!speed_impure_) {
+        const auto it = speed_cache_.find(score);
+        if (it != speed_cache_.end()) {
+            *out_ticks_per_sec = it->second;
+            return true;
+        }
+    }
+
     lua_getglobal(L_, "speed_ticks_per_sec");
     if (!lua_isfunction(L_, -1)) {
         lua_pop(L_, 1);
@@ -192,10 +574,17 @@ bool LuaRuntime::GetBaseTicksPerSec(int score, double* out_ticks_per_sec) {
     }
 
     *out_ticks_per_sec = tps;
+    if (!speed_impure_) {
+        speed_cache_.emplace(score, tps);
+    }
     last_error_.reset();
     return true;
 }
 
+const std::vector<snake::game::BonusSpawnWeight>& LuaRuntime::BonusSpawnWeights() const {
+    return bonus_spawn_;
+}
+
 bool LuaRuntime::GetSpeedTicksPerSec(int score, double* out_ticks_per_sec) {
     return GetBaseTicksPerSec(score, out_ticks_per_sec);
 }
@@ -204,8 +593,33 @@ bool LuaRuntime::PCall(int nargs, int nrets, std::string_view where) {
     const int base = lua_gettop(L_) - nargs;
     lua_pushcfunction(L_, &Traceback);
     lua_insert(L_, base);
+
+    StateStats& stats = *state_stats_;
+    const std::uint64_t allocs_before = stats.alloc_count;
+    const std::uint64_t bytes_before = stats.alloc_bytes;
+    stats.budget = instruction_budget_;
+    stats.budget_hit = false;
+    if (instruction_budget_ > 0) {
+        lua_sethook(L_, &LuaRuntime::BudgetHook, LUA_MASKCOUNT, instruction_budget_);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
     const int status = lua_pcall(L_, nargs, nrets, base);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    if (instruction_budget_ > 0) {
+        lua_sethook(L_, nullptr, 0, 0);
+    }
     lua_remove(L_, base);
+
+    LuaProfiler::CallResult result;
+    result.ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    result.alloc_count = stats.alloc_count - allocs_before;
+    result.alloc_bytes = stats.alloc_bytes - bytes_before;
+    result.error = status != LUA_OK;
+    result.budget_abort = stats.budget_hit;
+    profiler_.Record(where, result);
+
     if (status != LUA_OK) {
         const char* msg = lua_tostring(L_, -1);
         SetError(where, msg ? msg : "unknown lua error");
@@ -216,7 +630,13 @@ bool LuaRuntime::PCall(int nargs, int nrets, std::string_view where) {
 }
 
 bool LuaRuntime::LoadFile(const std::filesystem::path& p, std::string_view where) {
-    if (luaL_loadfile(L_, p.string().c_str()) != LUA_OK) {
+    ChunkLoadInfo info;
+    const int status = LoadChunkCached(L_, p, &info);
+    SDL_Log("Lua chunk %s: %s, %.2f ms",
+            p.filename().string().c_str(),
+            info.cache_hit ? "bytecode cache hit" : (info.cache_written ? "compiled, cached" : "compiled"),
+            info.ms);
+    if (status != LUA_OK) {
         const char* msg = lua_tostring(L_, -1);
         SetError(where, msg ? msg : "loadfile failed");
         lua_pop(L_, 1);
@@ -228,6 +648,183 @@ bool LuaRuntime::LoadFile(const std::filesystem::path& p, std::string_view where
     return true;
 }
 
+bool LuaRuntime::LoadCompiled(const CompiledChunk& chunk, std::string_view where) {
+    if (LoadCompiledChunk(L_, chunk) != LUA_OK) {
+        const char* msg = lua_tostring(L_, -1);
+        SetError(where, msg ? msg : "load failed");
+        lua_pop(L_, 1);
+        return false;
+    }
+    return PCall(0, LUA_MULTRET, where);
+}
+
+void LuaRuntime::ResolveHooks() {
+    ReleaseHooks();
+    if (!IsReady()) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < kHookCount; ++i) {
+        lua_getglobal(L_, kHookNames[i]);
+        if (!lua_isfunction(L_, -1) || IsEmptyLuaFunction(L_)) {
+            lua_pop(L_, 1);
+            continue;
+        }
+        hook_refs_[i] = luaL_ref(L_, LUA_REGISTRYINDEX);
+        hook_mask_ |= HookBit(static_cast<Hook>(i));
+    }
+}
+
+void LuaRuntime::ReleaseHooks() {
+    if (IsReady()) {
+        for (int& ref : hook_refs_) {
+            luaL_unref(L_, LUA_REGISTRYINDEX, ref);
+        }
+    }
+    hook_refs_.fill(LUA_NOREF);
+    hook_mask_ = 0;
+}
+
+void LuaRuntime::BindGameView() {
+    if (!IsReady()) {
+        return;
+    }
+    if (ctx_ref_ != LUA_NOREF) {
+        lua_rawgeti(L_, LUA_REGISTRYINDEX, ctx_ref_);
+        GameView::Unbind(L_, -1);
+        lua_pop(L_, 1);
+        luaL_unref(L_, LUA_REGISTRYINDEX, ctx_ref_);
+        ctx_ref_ = LUA_NOREF;
+    }
+    if (game_ == nullptr) {
+        return;
+    }
+    GameView::Push(L_, game_);
+    ctx_ref_ = luaL_ref(L_, LUA_REGISTRYINDEX);
+}
+
+void LuaRuntime::PushEventBatch() {
+    if (events_ref_ == LUA_NOREF) {
+        lua_createtable(L_, kEventReserve, 4);
+        events_ref_ = luaL_ref(L_, LUA_REGISTRYINDEX);
+        lua_createtable(L_, kEventReserve, 0);
+        event_pool_ref_ = luaL_ref(L_, LUA_REGISTRYINDEX);
+    }
+    lua_rawgeti(L_, LUA_REGISTRYINDEX, event_pool_ref_);
+    lua_rawgeti(L_, LUA_REGISTRYINDEX, events_ref_);
+    const int pool = lua_gettop(L_) - 1;
+    const int events = pool + 1;
+
+    const auto count = static_cast<int>(queued_count_);
+    for (int i = 0; i < count; ++i) {
+        const QueuedEvent& e = queued_events_[static_cast<std::size_t>(i)];
+        if (lua_rawgeti(L_, pool, i + 1) != LUA_TTABLE) {
+            lua_pop(L_, 1);
+            lua_createtable(L_, 0, 3);
+            lua_pushvalue(L_, -1);
+            lua_rawseti(L_, pool, i + 1);
+        }
+        lua_pushinteger(L_, static_cast<lua_Integer>(e.tick));
+        lua_setfield(L_, -2, "tick");
+        lua_pushstring(L_, kGameEventNames[static_cast<std::size_t>(e.type)]);
+        lua_setfield(L_, -2, "type");
+        if (e.detail.empty()) {
+            lua_pushnil(L_);
+        } else {
+            lua_pushlstring(L_, e.detail.data(), e.detail.size());
+        }
+        lua_setfield(L_, -2, "bonus_type");
+        lua_rawseti(L_, events, i + 1);
+    }
+    for (int i = count; i < events_sent_; ++i) {
+        lua_pushnil(L_);
+        lua_rawseti(L_, events, i + 1);
+    }
+    events_sent_ = count;
+
+    lua_pushinteger(L_, count);
+    lua_setfield(L_, events, "n");
+    lua_pushinteger(L_, queued_ticks_);
+    lua_setfield(L_, events, "ticks");
+    lua_pushinteger(L_, static_cast<lua_Integer>(queued_first_tick_));
+    lua_setfield(L_, events, "first_tick");
+    lua_pushinteger(L_, static_cast<lua_Integer>(queued_last_tick_));
+    lua_setfield(L_, events, "last_tick");
+    lua_remove(L_, pool);
+}
+
+void LuaRuntime::ClearEventBatch() {
+    queued_count_ = 0;
+    queued_ticks_ = 0;
+    queued_first_tick_ = 0;
+    queued_last_tick_ = 0;
+}
+
+void LuaRuntime::ResetSpeedCache() {
+    speed_cache_.clear();
+    speed_impure_ = false;
+    if (!IsReady()) {
+        return;
+    }
+    lua_getglobal(L_, "speed_ticks_per_sec_impure");
+    speed_impure_ = lua_toboolean(L_, -1) != 0;
+    lua_pop(L_, 1);
+}
+
+void LuaRuntime::ReadBonusSpawn() {
+    bonus_spawn_.clear();
+    if (!IsReady()) {
+        return;
+    }
+    lua_getglobal(L_, "bonus_spawn");
+    if (!lua_istable(L_, -1)) {
+        lua_pop(L_, 1);
+        return;
+    }
+
+    lua_pushnil(L_);
+    while (lua_next(L_, -2) != 0) {
+        const char* kind = lua_type(L_, -2) == LUA_TSTRING ? lua_tostring(L_, -2) : nullptr;
+        std::optional<snake::game::BonusType> type;
+        bool known = kind != nullptr;
+        if (known && std::strcmp(kind, "bonus_score") == 0) {
+            type = snake::game::BonusType::Score;
+        } else if (known && std::strcmp(kind, "bonus_slow") == 0) {
+            type = snake::game::BonusType::Slow;
+        } else if (!known || std::strcmp(kind, "none") != 0) {
+            known = false;
+        }
+
+        const double weight = lua_isnumber(L_, -1) ? lua_tonumber(L_, -1) : -1.0;
+        if (!known || !(weight >= 0.0)) {
+            SDL_Log("bonus_spawn: ignoring entry %s (expected none/bonus_score/bonus_slow = weight >= 0)",
+                    kind ? kind : luaL_typename(L_, -2));
+        } else {
+            bonus_spawn_.push_back({type, weight});
+        }
+        lua_pop(L_, 1);
+    }
+    lua_pop(L_, 1);
+
+    double total = 0.0;
+    for (const auto& w : bonus_spawn_) {
+        total += w.weight;
+    }
+    if (!bonus_spawn_.empty() && !(total > 0.0)) {
+        SDL_Log("bonus_spawn: weights sum to zero, using the default spawn table");
+        bonus_spawn_.clear();
+        return;
+    }
+
+    // lua_next order depends on the string hash seed; sort so the same rules and RNG seed
+    // always give the same spawns.
+    const auto rank = [](const snake::game::BonusSpawnWeight& w) {
+        return w.type ? 1 + static_cast<int>(*w.type) : 0;
+    };
+    std::sort(bonus_spawn_.begin(), bonus_spawn_.end(),
+              [&](const auto& a, const auto& b) { return rank(a) < rank(b); });
+}
+
 int LuaRuntime::Traceback(lua_State* L) {
     const char* msg = lua_tostring(L, 1);
     if (msg) {
@@ -250,6 +847,82 @@ int LuaRuntime::Traceback(lua_State* L) {
     return 1;
 }
 
+int LuaRuntime::Panic(lua_State* L) {
+    const char* msg = lua_tostring(L, -1);
+    SDL_Log("Lua panic: %s", msg ? msg : "unknown error");
+    return 0;
+}
+
+void* LuaRuntime::Alloc(void* ud, void* ptr, size_t osize, size_t nsize) {
+    auto* stats = static_cast<StateStats*>(ud);
+    const std::size_t old_size = ptr != nullptr ? osize : 0;  // osize is a type tag for new blocks
+    void* block = stats->pool.Realloc(ptr, osize, nsize);
+    if (nsize == 0) {
+        stats->in_use -= old_size;
+        return nullptr;
+    }
+    if (block == nullptr) {
+        return nullptr;
+    }
+    stats->in_use += nsize;
+    stats->in_use -= old_size;
+    if (nsize > old_size) {
+        ++stats->alloc_count;
+        stats->alloc_bytes += nsize - old_size;
+    }
+    return block;
+}
+
+void LuaRuntime::BudgetHook(lua_State* L, lua_Debug* /*ar*/) {
+    void* ud = nullptr;
+    lua_getallocf(L, &ud);
+    auto* stats = static_cast<StateStats*>(ud);
+    stats->budget_hit = true;
+    luaL_error(L, "instruction budget exceeded (%d instructions)", stats->budget);
+}
+
+int LuaRuntime::ResumeCoroutine(void* owner, lua_State* co, lua_State* from, int nargs) {
+    auto* self = static_cast<LuaRuntime*>(owner);
+    StateStats& stats = *self->state_stats_;
+    const std::uint64_t allocs_before = stats.alloc_count;
+    const std::uint64_t bytes_before = stats.alloc_bytes;
+    // A coroutine spawned from inside a hook must not clobber the hook's own budget state.
+    const int outer_budget = stats.budget;
+    const bool outer_hit = stats.budget_hit;
+    stats.budget = self->instruction_budget_;
+    stats.budget_hit = false;
+    if (self->instruction_budget_ > 0) {
+        lua_sethook(co, &LuaRuntime::BudgetHook, LUA_MASKCOUNT, self->instruction_budget_);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    int nres = 0;
+    const int status = lua_resume(co, from, nargs, &nres);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    lua_sethook(co, nullptr, 0, 0);
+
+    LuaProfiler::CallResult result;
+    result.ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    result.alloc_count = stats.alloc_count - allocs_before;
+    result.alloc_bytes = stats.alloc_bytes - bytes_before;
+    result.error = status != LUA_OK && status != LUA_YIELD;
+    result.budget_abort = stats.budget_hit;
+    self->profiler_.Record("coroutine", result);
+    stats.budget = outer_budget;
+    stats.budget_hit = outer_hit;
+
+    if (!result.error) {
+        lua_pop(co, nres);
+        return status;
+    }
+    const char* msg = lua_tostring(co, -1);
+    luaL_traceback(from, co, msg ? msg : "unknown lua error", 0);
+    self->SetError("coroutine", lua_tostring(from, -1));
+    lua_pop(from, 1);
+    return status;
+}
+
 void LuaRuntime::SetError(std::string_view where, std::string_view msg) {
     last_error_ = LuaError{std::string(msg), std::string(where)};
     const std::string combined = std::string(where) + ": " + std::string(msg);
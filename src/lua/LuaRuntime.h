@@ -2,10 +2,31 @@
 
 #include <lua.hpp>
 
+#include <array>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "game/Spawner.h"
+#include "lua/ChunkCache.h"
+#include "lua/CoroutineScheduler.h"
+#include "lua/LuaAllocator.h"
+#include "lua/LuaProfiler.h"
+
+namespace snake::game {
+class Game;
+}
+
+namespace snake::io {
+class Config;
+}
 
 namespace snake::lua {
 
@@ -14,12 +35,35 @@ struct LuaError {
     std::string where;
 };
 
+// Hooks from rules.lua (see docs/lua_api.md, section 4). Resolved once per load into
+// registry references so per-tick dispatch needs no string building or global lookup.
+enum class Hook : std::uint8_t {
+    AppInit,
+    RoundStart,
+    TickBegin,
+    TickEnd,
+    FoodEaten,
+    BonusPicked,
+    GameOver,
+    SettingChanged,
+    Events,
+    Count
+};
+
+// Entries of the batch passed to on_events (see docs/lua_api.md, section 4).
+enum class GameEvent : std::uint8_t { FoodEaten, BonusPicked };
+
+enum class ReloadStatus { Idle, Pending, Applied, Failed };
+
 class LuaRuntime {
 public:
     LuaRuntime();
     ~LuaRuntime();
 
-    bool Init();
+    // With `manual_gc` the collector is stopped and runs only through StepGc, so collection
+    // never lands inside a hook; the owner must then call StepGc regularly. Otherwise Lua's
+    // own incremental collector runs as usual (pools, benchmarks, tools).
+    bool Init(bool manual_gc = false);
     void Shutdown();
 
     bool IsReady() const;
@@ -27,30 +71,164 @@ public:
     void ClearLastError();
 
     bool LoadRules(const std::filesystem::path& rules_path);
-    bool LoadConfig(const std::filesystem::path& config_path);
-
-    bool CallVoid(std::string_view fn);
-    bool CallWithCtx(std::string_view fn, void* ctx_ptr);
-    bool CallWithCtxIfExists(std::string_view fn, void* ctx_ptr);
-    bool CallWithCtxIfExists(std::string_view fn, void* ctx_ptr, std::string_view arg1);
+    // Runs config.lua and publishes it as the global `config`. If `out` is given, the typed
+    // config is read from the same table, so the file is compiled and executed only once.
+    bool LoadConfig(const std::filesystem::path& config_path, snake::io::Config* out = nullptr);
+    // Same as above from precompiled bytecode, e.g. one compile shared by a LuaStatePool.
+    bool LoadRules(const CompiledChunk& rules);
+    bool LoadConfig(const CompiledChunk& config);
+
+    // The one script load order, used at startup, by hot reload and by LuaStatePool: config.lua
+    // first (published as `config`, and read into `typed_config` if given), then rules.lua, so
+    // top-level rules code can read `config`. If `want_rules` is set and returns false once the
+    // config is loaded, rules.lua is skipped (App does this when a native rules plugin takes
+    // over). Rules load even if the config failed; LastError then keeps the config error.
+    bool LoadScripts(const std::filesystem::path& config_path,
+                     const std::filesystem::path& rules_path,
+                     snake::io::Config* typed_config = nullptr,
+                     const std::function<bool()>& want_rules = {});
+    bool LoadScripts(const CompiledChunk& config, const CompiledChunk& rules);
+
+    // Game exposed to hooks as their `ctx` argument (a read-only GameView userdata).
+    // The binding survives hot reloads, but each Lua state gets its own view object, so
+    // scripts see a new ctx after a reload. Pass nullptr to unbind.
+    void SetGame(const snake::game::Game* game);
+    // Drops every coroutine parked by snake.spawn without resuming it.
+    void DropCoroutines();
+
+    // Cached hook dispatch. Absent hooks and hooks with an empty body are skipped without
+    // touching the Lua stack. Hooks are called as hook(ctx[, arg1]). TickBegin first advances
+    // the coroutine scheduler; RoundStart, FoodEaten, BonusPicked and GameOver then wake
+    // coroutines waiting on the matching event.
+    bool HasHook(Hook hook) const;
+    bool CallHook(Hook hook);
+    bool CallHook(Hook hook, std::string_view arg1);
+    // For hooks with custom arguments: pushes the hook function and ctx, and returns true if
+    // it should be called; the caller pushes the remaining arguments and finishes with
+    // CallPushedHook (nargs counts ctx).
+    bool PushHook(Hook hook);
+    bool CallPushedHook(Hook hook, int nargs);
+
+    // Batched delivery: the owner reports each simulated tick and its events, then calls
+    // FlushEvents once per frame, which makes a single on_events(ctx, events) call. The
+    // events table and its entries are reused between calls. All three are no-ops unless
+    // the rules define on_events.
+    void QueueTick(std::int64_t tick);
+    void QueueEvent(GameEvent type, std::int64_t tick, std::string_view detail = {});
+    bool FlushEvents();
 
     bool HotReload(const std::filesystem::path& rules_path, const std::filesystem::path& config_path);
 
+    // Background hot reload: a fresh state is built and loaded on a worker thread while the
+    // current one keeps running. PollHotReload must be called from the owning thread (once
+    // per frame); it swaps the new state in, or leaves the old one and sets LastError.
+    // Returns false if a reload is already in flight.
+    bool BeginHotReload(const std::filesystem::path& rules_path,
+                        const std::filesystem::path& config_path);
+    ReloadStatus PollHotReload();
+    bool HotReloadPending() const;
+    // Typed config read from the same config.lua run as the reloaded state's `config` global.
+    // Set when a reload is applied (HotReload or PollHotReload returning Applied); the owner
+    // takes it once so its settings never disagree with what the scripts see.
+    std::unique_ptr<snake::io::Config> TakeReloadedConfig();
+
     lua_State* L() const;
 
+    // Every PCall is timed and its allocations counted (see LuaProfiler).
+    const LuaProfiler& Profiler() const;
+    void ResetProfiler();
+    std::size_t HeapBytes() const;
+    // For Init(true) states (no-op otherwise): the owner calls this once per frame to run
+    // incremental collection steps for at most `budget_sec`. Steps are skipped while the heap has not
+    // grown since the last finished cycle, and exceed the budget only if the heap runs far
+    // past its previous live size.
+    void StepGc(double budget_sec);
+    // Aborts any single Lua call after `instructions` VM instructions (0 = unlimited).
+    void SetInstructionBudget(int instructions);
+    int InstructionBudget() const;
+
+    // Global `bonus_spawn` table from rules.lua, read once per rules load. Empty when the rules
+    // do not define it (the spawner then keeps its default table).
+    const std::vector<snake::game::BonusSpawnWeight>& BonusSpawnWeights() const;
+
     // speed_ticks_per_sec(score, config) -> number (>0)
     bool GetBaseTicksPerSec(int score, double* out_ticks_per_sec);
     bool GetSpeedTicksPerSec(int score, double* out_ticks_per_sec);
 
 private:
+    static constexpr std::size_t kHookCount = static_cast<std::size_t>(Hook::Count);
+
+    // Owned by the lua_State through its allocator userdata, so it moves with the state
+    // on hot reload.
+    struct StateStats {
+        LuaPoolAllocator pool;
+        std::uint64_t alloc_count = 0;
+        std::uint64_t alloc_bytes = 0;
+        std::size_t in_use = 0;
+        int budget = 0;
+        bool budget_hit = false;
+        std::size_t gc_live_bytes = 0;  // heap size right after the last finished GC cycle
+        bool gc_cycle_running = false;
+    };
+
     lua_State* L_ = nullptr;
+    std::unique_ptr<StateStats> state_stats_;
+    std::unique_ptr<CoroutineScheduler> scheduler_;  // closures hold its address; moves with L_
+    LuaProfiler profiler_;
+    int instruction_budget_ = 0;
+    bool manual_gc_ = false;  // kept across hot reloads: the new state is built the same way
     std::optional<LuaError> last_error_;
     std::string last_logged_error_;
+    std::array<int, kHookCount> hook_refs_{};
+    std::uint32_t hook_mask_ = 0;  // bit set => hook exists and does something
+    const snake::game::Game* game_ = nullptr;
+    int ctx_ref_ = LUA_NOREF;  // GameView userdata for game_
+    // speed_ticks_per_sec(score, config) memoised per score; cleared on rules/config load.
+    std::unordered_map<int, double> speed_cache_;
+    bool speed_impure_ = false;  // rules set speed_ticks_per_sec_impure = true
+    std::vector<snake::game::BonusSpawnWeight> bonus_spawn_;
+    std::future<std::unique_ptr<LuaRuntime>> reload_future_;
+    std::unique_ptr<snake::io::Config> reloaded_config_;
+
+    struct QueuedEvent {
+        GameEvent type = GameEvent::FoodEaten;
+        std::int64_t tick = 0;
+        std::string detail;  // bonus type for BonusPicked
+    };
+    std::vector<QueuedEvent> queued_events_;
+    std::size_t queued_count_ = 0;  // live prefix of queued_events_; the rest is reused storage
+    int queued_ticks_ = 0;
+    std::int64_t queued_first_tick_ = 0;
+    std::int64_t queued_last_tick_ = 0;
+    int events_ref_ = LUA_NOREF;      // table passed to on_events
+    int event_pool_ref_ = LUA_NOREF;  // entry tables, reused across calls
+    int events_sent_ = 0;             // entries currently set in the events table
 
     bool PCall(int nargs, int nrets, std::string_view where);
     bool LoadFile(const std::filesystem::path& p, std::string_view where);
+    bool LoadCompiled(const CompiledChunk& chunk, std::string_view where);
+    bool FinishRulesLoad(bool ok);
+    bool FinishScriptsLoad(bool config_ok, bool rules_ok, std::optional<LuaError> config_error);
+    bool PublishConfig(int top_before, bool loaded);
+    void ResolveHooks();
+    void ReleaseHooks();
+    void BindGameView();
+    void PushEventBatch();
+    void ClearEventBatch();
+    void ResetSpeedCache();
+    void ReadBonusSpawn();
+    static std::unique_ptr<LuaRuntime> BuildReloadState(const std::filesystem::path& rules_path,
+                                                        const std::filesystem::path& config_path,
+                                                        const snake::game::Game* game,
+                                                        bool manual_gc);
+    void AdoptState(LuaRuntime& next);
 
     static int Traceback(lua_State* L);
+    static int Panic(lua_State* L);
+    static void* Alloc(void* ud, void* ptr, size_t osize, size_t nsize);
+    static void BudgetHook(lua_State* L, lua_Debug* ar);
+    static int ResumeCoroutine(void* owner, lua_State* co, lua_State* from, int nargs);
+    void WakeCoroutines(Hook hook, std::string_view arg);
     void SetError(std::string_view where, std::string_view msg);
 };
 
@@ -0,0 +1,146 @@
+#include "lua/LuaStatePool.h"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "lua/Bindings.h"
+
+namespace snake::lua {
+
+LuaStatePool::Lease::Lease(LuaStatePool* pool, std::size_t index) : pool_(pool), index_(index) {}
+
+LuaStatePool::Lease::Lease(Lease&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)), index_(other.index_) {}
+
+LuaStatePool::Lease& LuaStatePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        Release();
+        pool_ = std::exchange(other.pool_, nullptr);
+        index_ = other.index_;
+    }
+    return *this;
+}
+
+LuaStatePool::Lease::~Lease() {
+    Release();
+}
+
+LuaStatePool::Lease::operator bool() const {
+    return pool_ != nullptr;
+}
+
+LuaRuntime& LuaStatePool::Lease::operator*() const {
+    return *pool_->states_[index_];
+}
+
+LuaRuntime* LuaStatePool::Lease::operator->() const {
+    return pool_->states_[index_].get();
+}
+
+void LuaStatePool::Lease::Release() {
+    if (pool_ != nullptr) {
+        std::exchange(pool_, nullptr)->Release(index_);
+    }
+}
+
+LuaStatePool::~LuaStatePool() {
+    Shutdown();
+}
+
+bool LuaStatePool::Init(const std::filesystem::path& rules_path,
+                        const std::filesystem::path& config_path,
+                        std::size_t size) {
+    Shutdown();
+    if (size == 0) {
+        size = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    CompiledChunk rules;
+    CompiledChunk config;
+    std::string error;
+    if (!CompileChunk(rules_path, &rules, &error)) {
+        last_error_ = LuaError{error, "pool:loadfile:rules.lua"};
+        return false;
+    }
+    if (!CompileChunk(config_path, &config, &error)) {
+        last_error_ = LuaError{error, "pool:loadfile:config.lua"};
+        return false;
+    }
+
+    states_.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        auto lua = std::make_unique<LuaRuntime>();
+        if (!lua->Init()) {
+            last_error_ = lua->LastError();
+            Shutdown();
+            return false;
+        }
+        Bindings::Register(lua->L());
+        if (!lua->LoadScripts(config, rules)) {
+            last_error_ = lua->LastError();
+            Shutdown();
+            return false;
+        }
+        states_.push_back(std::move(lua));
+    }
+
+    free_.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        free_[i] = size - 1 - i;  // hand out index 0 first
+    }
+    SDL_Log("Lua state pool: %zu states, rules %zu bytes of bytecode", size, rules.bytecode.size());
+    return true;
+}
+
+void LuaStatePool::Shutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.clear();
+    states_.clear();
+}
+
+std::size_t LuaStatePool::Size() const {
+    return states_.size();
+}
+
+const std::optional<LuaError>& LuaStatePool::LastError() const {
+    return last_error_;
+}
+
+LuaStatePool::Lease LuaStatePool::Acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (states_.empty()) {
+        return {};
+    }
+    available_.wait(lock, [this] { return !free_.empty(); });
+    const std::size_t index = free_.back();
+    free_.pop_back();
+    return Lease(this, index);
+}
+
+LuaStatePool::Lease LuaStatePool::TryAcquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) {
+        return {};
+    }
+    const std::size_t index = free_.back();
+    free_.pop_back();
+    return Lease(this, index);
+}
+
+void LuaStatePool::Release(std::size_t index) {
+    // The leaseholder's Game may be gone by now: detach the ctx view and drop parked coroutines
+    // so the next lease cannot reach it through state left over from this one.
+    states_[index]->SetGame(nullptr);
+    states_[index]->DropCoroutines();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(index);
+    }
+    available_.notify_one();
+}
+
+}  // namespace snake::lua
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "lua/ChunkCache.h"
+#include "lua/LuaRuntime.h"
+
+namespace snake::lua {
+
+// Independent LuaRuntimes for batch/headless work, one per worker thread. rules.lua and
+// config.lua are compiled once and every state loads the same bytecode, so speed curves, spawn
+// tables and hooks behave exactly as in the game. A runtime is used by one thread at a time
+// through a Lease; different leases can run in parallel.
+class LuaStatePool {
+public:
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        explicit operator bool() const;
+        LuaRuntime& operator*() const;
+        LuaRuntime* operator->() const;
+        // Returns the runtime to the pool early (also done by the destructor).
+        void Release();
+
+    private:
+        friend class LuaStatePool;
+        Lease(LuaStatePool* pool, std::size_t index);
+
+        LuaStatePool* pool_ = nullptr;
+        std::size_t index_ = 0;
+    };
+
+    LuaStatePool() = default;
+    ~LuaStatePool();
+    LuaStatePool(const LuaStatePool&) = delete;
+    LuaStatePool& operator=(const LuaStatePool&) = delete;
+
+    // Builds `size` runtimes (0 = std::thread::hardware_concurrency()). Fails if any state
+    // fails to load; LastError then holds the first error. Must not be called while leases
+    // are outstanding.
+    bool Init(const std::filesystem::path& rules_path,
+              const std::filesystem::path& config_path,
+              std::size_t size = 0);
+    void Shutdown();
+
+    std::size_t Size() const;
+    const std::optional<LuaError>& LastError() const;
+
+    // Blocks until a runtime is free. On release the lease unbinds any game set with SetGame
+    // (ctx copies kept by scripts are detached) and drops coroutines parked by snake.spawn.
+    // Other Lua globals persist between leases.
+    Lease Acquire();
+    // Empty lease if every runtime is in use.
+    Lease TryAcquire();
+
+private:
+    void Release(std::size_t index);
+
+    std::vector<std::unique_ptr<LuaRuntime>> states_;
+    std::vector<std::size_t> free_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+    std::optional<LuaError> last_error_;
+};
+
+}  // namespace snake::lua
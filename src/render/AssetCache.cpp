@@ -0,0 +1,73 @@
+#include "render/AssetCache.h"
+
+#include <SDL_image.h>
+
+#include <system_error>
+
+namespace snake::render {
+
+AssetCache::~AssetCache() {
+    Clear();
+}
+
+const AssetCache::Image& AssetCache::LoadImage(const std::filesystem::path& path) {
+    const std::string key = path.string();
+    auto it = images_.find(key);
+    if (it != images_.end()) {
+        ++stats_.hits;
+        return it->second;
+    }
+
+    ++stats_.disk_loads;
+    Image image;
+    std::error_code ec;
+    image.exists = std::filesystem::exists(path, ec);
+    if (image.exists) {
+        image.surface = IMG_Load(key.c_str());
+        if (image.surface == nullptr) {
+            image.error = IMG_GetError();
+        }
+    }
+    return images_.emplace(key, std::move(image)).first->second;
+}
+
+TTF_Font* AssetCache::LoadFont(const std::filesystem::path& path, int pt_size, std::string* error) {
+    auto key = std::make_pair(path.string(), pt_size);
+    auto it = fonts_.find(key);
+    if (it != fonts_.end()) {
+        ++stats_.hits;
+    } else {
+        ++stats_.disk_loads;
+        FontEntry entry;
+        entry.font = TTF_OpenFont(key.first.c_str(), pt_size);
+        if (entry.font == nullptr) {
+            entry.error = TTF_GetError();
+        }
+        it = fonts_.emplace(std::move(key), std::move(entry)).first;
+    }
+    if (it->second.font == nullptr && error != nullptr) {
+        *error = it->second.error;
+    }
+    return it->second.font;
+}
+
+void AssetCache::Clear() {
+    for (auto& [path, image] : images_) {
+        if (image.surface != nullptr) {
+            SDL_FreeSurface(image.surface);
+        }
+    }
+    images_.clear();
+    for (auto& [key, entry] : fonts_) {
+        if (entry.font != nullptr) {
+            TTF_CloseFont(entry.font);
+        }
+    }
+    fonts_.clear();
+}
+
+const AssetCache::Stats& AssetCache::GetStats() const {
+    return stats_;
+}
+
+}  // namespace snake::render
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace snake::render {
+
+// Decoded images and opened fonts, kept for the life of the process. Neither depends on an
+// SDL_Renderer, so recreating the renderer (VSync toggle) only re-uploads textures instead of
+// re-reading PNGs and TTFs. Failed loads are cached too: a missing optional sprite costs one
+// stat per process, not one per renderer. Assets are not hot-reloaded, so entries never go stale.
+//
+// The cache owns every surface and font it returns. Clear() must run before TTF_Quit/IMG_Quit.
+class AssetCache {
+public:
+    struct Image {
+        SDL_Surface* surface = nullptr;  // nullptr if the file is missing or failed to decode
+        bool exists = false;             // file was present on disk
+        std::string error;               // IMG_GetError() when decoding failed
+    };
+
+    struct Stats {
+        std::uint64_t disk_loads = 0;  // image decodes and font opens, failed ones included
+        std::uint64_t hits = 0;
+    };
+
+    AssetCache() = default;
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+    ~AssetCache();
+
+    // Decodes the image on first request. The returned entry stays valid until Clear().
+    const Image& LoadImage(const std::filesystem::path& path);
+    // Opens the font at `pt_size` on first request; nullptr on failure, with TTF_GetError()
+    // (remembered from the first attempt) in `error` when provided.
+    TTF_Font* LoadFont(const std::filesystem::path& path, int pt_size, std::string* error);
+
+    void Clear();
+    const Stats& GetStats() const;
+
+private:
+    struct FontEntry {
+        TTF_Font* font = nullptr;
+        std::string error;
+    };
+
+    std::unordered_map<std::string, Image> images_;
+    std::map<std::pair<std::string, int>, FontEntry> fonts_;
+    Stats stats_;
+};
+
+}  // namespace snake::render
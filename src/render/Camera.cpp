@@ -0,0 +1,57 @@
+#include "render/Camera.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace snake::render {
+
+void Camera::Update(double dt_seconds, SDL_Point focus_px, int view_w, int view_h, int board_px_w, int board_px_h) {
+    const double max_x = std::max(0, board_px_w - view_w);
+    const double max_y = std::max(0, board_px_h - view_h);
+    const double target_x = std::clamp(focus_px.x - view_w / 2.0, 0.0, max_x);
+    const double target_y = std::clamp(focus_px.y - view_h / 2.0, 0.0, max_y);
+
+    const bool resized = view_w != view_w_ || view_h != view_h_ || board_px_w != board_px_w_ ||
+                         board_px_h != board_px_h_;
+    const bool jump = std::abs(target_x - x_) > view_w / 2.0 || std::abs(target_y - y_) > view_h / 2.0;
+    if (snap_ || resized || jump) {
+        x_ = target_x;
+        y_ = target_y;
+    } else {
+        const double k = 1.0 - std::exp(-kFollowRate * std::max(0.0, dt_seconds));
+        x_ += (target_x - x_) * k;
+        y_ += (target_y - y_) * k;
+    }
+    view_w_ = view_w;
+    view_h_ = view_h;
+    board_px_w_ = board_px_w;
+    board_px_h_ = board_px_h;
+    snap_ = false;
+}
+
+void Camera::Reset() {
+    snap_ = true;
+}
+
+SDL_Point Camera::Offset() const {
+    return SDL_Point{static_cast<int>(std::lround(x_)), static_cast<int>(std::lround(y_))};
+}
+
+bool Camera::Scrolls() const {
+    return view_w_ < board_px_w_ || view_h_ < board_px_h_;
+}
+
+Camera::TileSpan Camera::VisibleTiles(int tile_px, int board_w, int board_h) const {
+    if (tile_px <= 0) {
+        return {};
+    }
+    const SDL_Point off = Offset();
+    TileSpan span;
+    span.x0 = std::clamp(off.x / tile_px, 0, board_w);
+    span.y0 = std::clamp(off.y / tile_px, 0, board_h);
+    span.x1 = std::clamp((off.x + view_w_ + tile_px - 1) / tile_px, 0, board_w);
+    span.y1 = std::clamp((off.y + view_h_ + tile_px - 1) / tile_px, 0, board_h);
+    return span;
+}
+
+}  // namespace snake::render
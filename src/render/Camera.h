@@ -0,0 +1,47 @@
+#pragma once
+
+#include <SDL.h>
+
+#include "game/Types.h"
+
+namespace snake::render {
+
+// View onto the board, in board pixels. When the board is larger than the view the camera
+// follows a focus point (the snake's head) and stays inside the board; when it fits, the
+// offset is zero and the whole board is visible.
+class Camera {
+public:
+    // Visible tiles, half-open: [x0, x1) x [y0, y1).
+    struct TileSpan {
+        int x0 = 0;
+        int y0 = 0;
+        int x1 = 0;
+        int y1 = 0;
+
+        bool Contains(snake::game::Pos p) const { return p.x >= x0 && p.x < x1 && p.y >= y0 && p.y < y1; }
+        int Count() const { return (x1 - x0) * (y1 - y0); }
+    };
+
+    // Moves towards `focus_px` (board pixels) with exponential smoothing. Jumps larger than
+    // half the view (wrap-around, new round, zoom change) snap instead of sliding.
+    void Update(double dt_seconds, SDL_Point focus_px, int view_w, int view_h, int board_px_w, int board_px_h);
+    // The next Update snaps to its focus.
+    void Reset();
+
+    SDL_Point Offset() const;
+    bool Scrolls() const;
+    TileSpan VisibleTiles(int tile_px, int board_w, int board_h) const;
+
+private:
+    static constexpr double kFollowRate = 10.0;  // 1/s; ~90% of the way in 0.23 s
+
+    double x_ = 0.0;
+    double y_ = 0.0;
+    int view_w_ = 0;
+    int view_h_ = 0;
+    int board_px_w_ = 0;
+    int board_px_h_ = 0;
+    bool snap_ = true;
+};
+
+}  // namespace snake::render
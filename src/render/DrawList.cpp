@@ -0,0 +1,95 @@
+#include "render/DrawList.h"
+
+namespace snake::render {
+
+void DrawList::AddRect(const SDL_Rect& dst, SDL_Color color, SDL_BlendMode blend) {
+    BatchFor(nullptr, blend);
+    PushQuad(dst, color, 0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+void DrawList::AddSprite(SDL_Texture* texture,
+                         const SDL_Rect& src,
+                         const SDL_Rect& dst,
+                         SDL_Color tint,
+                         SDL_BlendMode blend) {
+    if (texture == nullptr) {
+        return;
+    }
+    if (texture != size_texture_) {
+        int w = 0;
+        int h = 0;
+        SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+        size_texture_ = texture;
+        inv_tex_w_ = w > 0 ? 1.0f / static_cast<float>(w) : 1.0f;
+        inv_tex_h_ = h > 0 ? 1.0f / static_cast<float>(h) : 1.0f;
+    }
+    BatchFor(texture, blend);
+    PushQuad(dst,
+             tint,
+             static_cast<float>(src.x) * inv_tex_w_,
+             static_cast<float>(src.y) * inv_tex_h_,
+             static_cast<float>(src.x + src.w) * inv_tex_w_,
+             static_cast<float>(src.y + src.h) * inv_tex_h_);
+}
+
+DrawList::Batch& DrawList::BatchFor(SDL_Texture* texture, SDL_BlendMode blend) {
+    if (batches_.empty() || batches_.back().texture != texture || batches_.back().blend != blend) {
+        batches_.push_back(Batch{texture, blend, static_cast<int>(indices_.size()), 0});
+    }
+    return batches_.back();
+}
+
+void DrawList::PushQuad(const SDL_Rect& dst, SDL_Color color, float u0, float v0, float u1, float v1) {
+    const int base = static_cast<int>(vertices_.size());
+    const float x0 = static_cast<float>(dst.x);
+    const float y0 = static_cast<float>(dst.y);
+    const float x1 = static_cast<float>(dst.x + dst.w);
+    const float y1 = static_cast<float>(dst.y + dst.h);
+    vertices_.push_back(SDL_Vertex{SDL_FPoint{x0, y0}, color, SDL_FPoint{u0, v0}});
+    vertices_.push_back(SDL_Vertex{SDL_FPoint{x1, y0}, color, SDL_FPoint{u1, v0}});
+    vertices_.push_back(SDL_Vertex{SDL_FPoint{x1, y1}, color, SDL_FPoint{u1, v1}});
+    vertices_.push_back(SDL_Vertex{SDL_FPoint{x0, y1}, color, SDL_FPoint{u0, v1}});
+    const int quad[6] = {base, base + 1, base + 2, base, base + 2, base + 3};
+    indices_.insert(indices_.end(), quad, quad + 6);
+    batches_.back().index_count += 6;
+    ++stats_.quads;
+}
+
+void DrawList::Flush(SDL_Renderer* r) {
+    if (r != nullptr) {
+        for (const Batch& batch : batches_) {
+            if (batch.index_count == 0) {
+                continue;
+            }
+            if (batch.texture != nullptr) {
+                SDL_SetTextureBlendMode(batch.texture, batch.blend);
+            } else {
+                SDL_SetRenderDrawBlendMode(r, batch.blend);
+            }
+            SDL_RenderGeometry(r,
+                               batch.texture,
+                               vertices_.data(),
+                               static_cast<int>(vertices_.size()),
+                               indices_.data() + batch.first_index,
+                               batch.index_count);
+            ++stats_.draw_calls;
+        }
+        SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+    }
+    vertices_.clear();
+    indices_.clear();
+    batches_.clear();
+    // Textures may be destroyed after a flush and the allocator can hand the same pointer to
+    // a new texture of another size (board layers on zoom or resize), so the cache ends here.
+    size_texture_ = nullptr;
+}
+
+const DrawList::Stats& DrawList::GetStats() const {
+    return stats_;
+}
+
+void DrawList::ResetStats() {
+    stats_ = {};
+}
+
+}  // namespace snake::render
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <vector>
+
+// SDL_Vertex and SDL_RenderGeometry, which the list is built on, arrived in SDL 2.0.18.
+#if !SDL_VERSION_ATLEAST(2, 0, 18)
+#error "DrawList requires SDL 2.0.18 or newer"
+#endif
+
+namespace snake::render {
+
+// Collects quads in painter's order and submits each run that shares a texture and blend mode
+// as one SDL_RenderGeometry call. Vertex/index buffers are kept between frames, so a steady
+// frame does not allocate. Anything drawn directly with SDL must be preceded by Flush().
+class DrawList {
+public:
+    struct Stats {
+        int quads = 0;
+        int draw_calls = 0;
+    };
+
+    // Solid quad; `blend` is applied as the renderer draw blend mode.
+    void AddRect(const SDL_Rect& dst, SDL_Color color, SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    // Textured quad; `tint` is multiplied into the texels (alpha included).
+    void AddSprite(SDL_Texture* texture,
+                   const SDL_Rect& src,
+                   const SDL_Rect& dst,
+                   SDL_Color tint = SDL_Color{255, 255, 255, 255},
+                   SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+    // Submits queued quads and clears the list (capacity is kept). Draw blend mode is left
+    // at SDL_BLENDMODE_NONE, matching the rest of the renderer.
+    void Flush(SDL_Renderer* r);
+
+    // Counters since the last ResetStats (one frame, normally).
+    const Stats& GetStats() const;
+    void ResetStats();
+
+private:
+    struct Batch {
+        SDL_Texture* texture = nullptr;
+        SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+        int first_index = 0;
+        int index_count = 0;
+    };
+
+    Batch& BatchFor(SDL_Texture* texture, SDL_BlendMode blend);
+    void PushQuad(const SDL_Rect& dst, SDL_Color color, float u0, float v0, float u1, float v1);
+
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+    std::vector<Batch> batches_;
+    SDL_Texture* size_texture_ = nullptr;  // texture whose size is cached below; reset by Flush
+    float inv_tex_w_ = 1.0f;
+    float inv_tex_h_ = 1.0f;
+    Stats stats_;
+};
+
+}  // namespace snake::render
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <cstring>
 
+#include "render/DrawList.h"
+#include "render/SpriteAtlas.h"
 #include "render/TextRenderer.h"
 
 namespace snake::render {
@@ -78,17 +80,17 @@ void Effects::Update(double dt_seconds) {
     update_list(pulses_);
 }
 
-void Effects::RenderFoodEats(SDL_Renderer* r, SDL_Texture* food_tex, SDL_Point origin, int tile_px) {
-    if (r == nullptr || food_eats_.empty()) {
+void Effects::RenderFoodEats(DrawList& list,
+                             const SpriteAtlas& sprites,
+                             SDL_Point origin,
+                             int tile_px,
+                             const SDL_Rect& visible) {
+    if (food_eats_.empty()) {
         return;
     }
 
-    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
-
-    Uint8 restore_alpha = 255;
-    if (food_tex != nullptr) {
-        SDL_GetTextureAlphaMod(food_tex, &restore_alpha);
-    }
+    const SDL_Rect* food_src = sprites.Get("food");
+    SDL_Texture* food_tex = food_src != nullptr ? sprites.Texture() : nullptr;
 
     for (const auto& effect : food_eats_) {
         if (effect.duration <= 0.0) {
@@ -99,26 +101,22 @@ void Effects::RenderFoodEats(SDL_Renderer* r, SDL_Texture* food_tex, SDL_Point o
         const double alpha = 1.0 - t;
         const int size = std::max(1, static_cast<int>(std::round(tile_px * scale)));
         SDL_Rect dst = TileRect(origin, tile_px, effect.pos, size);
+        if (!SDL_HasIntersection(&dst, &visible)) {
+            continue;
+        }
         if (food_tex != nullptr) {
-            SDL_SetTextureAlphaMod(food_tex, ScaleAlpha(255, alpha));
-            SDL_RenderCopy(r, food_tex, nullptr, &dst);
+            list.AddSprite(food_tex, *food_src, dst, SDL_Color{255, 255, 255, ScaleAlpha(255, alpha)});
         } else {
-            SDL_Color color{200, 80, 80, ScaleAlpha(255, alpha)};
-            SDL_SetRenderDrawColor(r, color.r, color.g, color.b, color.a);
-            SDL_RenderFillRect(r, &dst);
+            list.AddRect(dst, SDL_Color{200, 80, 80, ScaleAlpha(255, alpha)}, SDL_BLENDMODE_BLEND);
         }
     }
-
-    if (food_tex != nullptr) {
-        SDL_SetTextureAlphaMod(food_tex, restore_alpha);
-    }
-    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
 }
 
 void Effects::RenderFloatingText(SDL_Renderer* r,
                                  const TextRenderer& text_renderer,
                                  SDL_Point origin,
-                                 int tile_px) {
+                                 int tile_px,
+                                 const SDL_Rect& visible) {
     if (r == nullptr || floating_texts_.empty()) {
         return;
     }
@@ -134,6 +132,16 @@ void Effects::RenderFloatingText(SDL_Renderer* r,
         const double fade = t > 0.65 ? (1.0 - (t - 0.65) / 0.35) : 1.0;
         const SDL_Color color{effect.color.r, effect.color.g, effect.color.b, ScaleAlpha(effect.color.a, fade)};
 
+        // Cheap reject before measuring: the text stays within a margin around its tile.
+        const int margin = std::max(tile_px * 2, 64);
+        const SDL_Rect area{origin.x + effect.pos.x * tile_px - margin,
+                            origin.y + effect.pos.y * tile_px - margin,
+                            tile_px + margin * 2,
+                            tile_px + margin * 2};
+        if (!SDL_HasIntersection(&area, &visible)) {
+            continue;
+        }
+
         const std::string_view text(effect.text.data(), effect.text_len);
         const auto metrics = text_renderer.MeasureText(text, 16);
         const int base_x = origin.x + effect.pos.x * tile_px + tile_px / 2;
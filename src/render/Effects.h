@@ -11,6 +11,8 @@
 
 namespace snake::render {
 
+class DrawList;
+class SpriteAtlas;
 class TextRenderer;
 
 class Effects {
@@ -26,8 +28,18 @@ public:
     void Reset();
     void Update(double dt_seconds);
 
-    void RenderFoodEats(SDL_Renderer* r, SDL_Texture* food_tex, SDL_Point origin, int tile_px);
-    void RenderFloatingText(SDL_Renderer* r, const TextRenderer& text_renderer, SDL_Point origin, int tile_px);
+    // Board effects are placed at `origin` + tile * tile_px; those entirely outside `visible`
+    // (framebuffer pixels) are skipped.
+    void RenderFoodEats(DrawList& list,
+                        const SpriteAtlas& sprites,
+                        SDL_Point origin,
+                        int tile_px,
+                        const SDL_Rect& visible);
+    void RenderFloatingText(SDL_Renderer* r,
+                            const TextRenderer& text_renderer,
+                            SDL_Point origin,
+                            int tile_px,
+                            const SDL_Rect& visible);
     void RenderPulse(SDL_Renderer* r, const SDL_Rect& viewport_rect);
 
     void SpawnFoodEat(snake::game::Pos pos);
@@ -8,26 +8,36 @@ Font::~Font() {
     Reset();
 }
 
-bool Font::Load(const std::filesystem::path& ttf_path, int pt_size) {
+bool Font::Load(const std::filesystem::path& ttf_path, int pt_size, AssetCache* cache) {
     Reset();
     font_path_ = ttf_path;
     const std::string path = ttf_path.string();
-    font_ = TTF_OpenFont(path.c_str(), pt_size);
+    if (cache != nullptr) {
+        font_ = cache->LoadFont(ttf_path, pt_size, &last_error_);
+    } else {
+        font_ = TTF_OpenFont(path.c_str(), pt_size);
+        if (font_ == nullptr) {
+            last_error_ = TTF_GetError();
+        }
+    }
+    owns_font_ = cache == nullptr;
     if (font_ == nullptr) {
-        last_error_ = TTF_GetError();
         SDL_Log("TTF_OpenFont failed for '%s': %s", path.c_str(), last_error_.c_str());
         return false;
     }
+    pt_size_ = pt_size;
     last_error_.clear();
     SDL_Log("Loaded font: %s", path.c_str());
     return true;
 }
 
 void Font::Reset() {
-    if (font_ != nullptr) {
+    if (font_ != nullptr && owns_font_) {
         TTF_CloseFont(font_);
-        font_ = nullptr;
     }
+    font_ = nullptr;
+    owns_font_ = false;
+    pt_size_ = 0;
     last_error_.clear();
     font_path_.clear();
 }
@@ -44,10 +54,11 @@ bool Font::MeasureText(std::string_view text, int* out_w, int* out_h) const {
 
     int w = 0;
     int h = 0;
-    if (TTF_SizeUTF8(font_, std::string(text).c_str(), &w, &h) != 0) {
+    const std::pmr::string c_text = CString(text);
+    if (TTF_SizeUTF8(font_, c_text.c_str(), &w, &h) != 0) {
         last_error_ = TTF_GetError();
         SDL_Log("TTF_SizeUTF8 failed for '%s' (font: %s): %s",
-                std::string(text).c_str(),
+                c_text.c_str(),
                 font_path_.string().c_str(),
                 last_error_.c_str());
         return false;
@@ -70,17 +81,34 @@ const std::filesystem::path& Font::FontPath() const {
     return font_path_;
 }
 
+TTF_Font* Font::Handle() const {
+    return font_;
+}
+
+int Font::PtSize() const {
+    return pt_size_;
+}
+
+void Font::SetScratch(std::pmr::memory_resource* scratch) {
+    scratch_ = scratch != nullptr ? scratch : std::pmr::get_default_resource();
+}
+
+std::pmr::string Font::CString(std::string_view text) const {
+    return std::pmr::string(text, scratch_);
+}
+
 SDL_Texture* Font::RenderText(SDL_Renderer* r, std::string_view text, SDL_Color color, int* out_w, int* out_h) const {
     if (font_ == nullptr) {
         last_error_ = "TTF font not loaded";
         return nullptr;
     }
 
-    SDL_Surface* surface = TTF_RenderUTF8_Blended(font_, std::string(text).c_str(), color);
+    const std::pmr::string c_text = CString(text);
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font_, c_text.c_str(), color);
     if (surface == nullptr) {
         last_error_ = TTF_GetError();
         SDL_Log("TTF_RenderUTF8_Blended failed for '%s' (font: %s): %s",
-                std::string(text).c_str(),
+                c_text.c_str(),
                 font_path_.string().c_str(),
                 last_error_.c_str());
         return nullptr;
@@ -97,7 +125,7 @@ SDL_Texture* Font::RenderText(SDL_Renderer* r, std::string_view text, SDL_Color
     if (tex == nullptr) {
         last_error_ = SDL_GetError();
         SDL_Log("SDL_CreateTextureFromSurface failed for '%s' (font: %s): %s",
-                std::string(text).c_str(),
+                c_text.c_str(),
                 font_path_.string().c_str(),
                 last_error_.c_str());
     }
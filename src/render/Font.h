@@ -4,27 +4,41 @@
 #include <SDL_ttf.h>
 
 #include <filesystem>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
+#include "render/AssetCache.h"
+
 namespace snake::render {
 
 class Font {
 public:
     ~Font();
 
-    bool Load(const std::filesystem::path& ttf_path, int pt_size);
+    // With a `cache` the font handle is borrowed from it and Reset() leaves it open.
+    bool Load(const std::filesystem::path& ttf_path, int pt_size, AssetCache* cache = nullptr);
     void Reset();
     bool IsLoaded() const;
     bool MeasureText(std::string_view text, int* out_w, int* out_h) const;
     const std::string& LastError() const;
     const std::filesystem::path& FontPath() const;
+    TTF_Font* Handle() const;
+    int PtSize() const;
+    // SDL_ttf needs NUL-terminated text, so every call copies it. The copy is taken from
+    // `scratch` (the frame arena while rendering); nullptr restores the default resource.
+    void SetScratch(std::pmr::memory_resource* scratch);
 
     // Renders text to a texture (caller owns returned texture; provide helper for RAII usage)
     SDL_Texture* RenderText(SDL_Renderer* r, std::string_view text, SDL_Color color, int* out_w, int* out_h) const;
 
 private:
+    std::pmr::string CString(std::string_view text) const;
+
     TTF_Font* font_ = nullptr;
+    bool owns_font_ = false;
+    std::pmr::memory_resource* scratch_ = std::pmr::get_default_resource();
+    int pt_size_ = 0;
     std::filesystem::path font_path_;
     mutable std::string last_error_;
 };
@@ -0,0 +1,268 @@
+#include "render/GlyphAtlas.h"
+
+#include <algorithm>
+
+namespace snake::render {
+namespace {
+
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+#define SNAKE_HAS_TTF_GLYPH32 1
+#else
+#define SNAKE_HAS_TTF_GLYPH32 0
+#endif
+
+constexpr std::uint32_t kReplacement = '?';
+
+// Decodes one UTF-8 sequence starting at text[*i] and advances *i. Malformed input yields '?'.
+std::uint32_t NextCodepoint(std::string_view text, std::size_t* i) {
+    const auto byte = [&](std::size_t at) { return static_cast<unsigned char>(text[at]); };
+    const unsigned char lead = byte(*i);
+    int extra = 0;
+    std::uint32_t cp = 0;
+    if (lead < 0x80) {
+        ++*i;
+        return lead;
+    } else if ((lead & 0xE0) == 0xC0) {
+        extra = 1;
+        cp = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2;
+        cp = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3;
+        cp = lead & 0x07;
+    } else {
+        ++*i;
+        return kReplacement;
+    }
+    if (*i + extra >= text.size()) {
+        *i = text.size();
+        return kReplacement;
+    }
+    for (int k = 1; k <= extra; ++k) {
+        const unsigned char c = byte(*i + k);
+        if ((c & 0xC0) != 0x80) {
+            *i += k;
+            return kReplacement;
+        }
+        cp = (cp << 6) | (c & 0x3F);
+    }
+    *i += extra + 1;
+    return cp;
+}
+
+std::uint64_t GlyphKey(int pt_size, std::uint32_t codepoint) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(pt_size)) << 32) | codepoint;
+}
+
+bool HasGlyph(TTF_Font* font, std::uint32_t cp) {
+#if SNAKE_HAS_TTF_GLYPH32
+    return TTF_GlyphIsProvided32(font, cp) != 0;
+#else
+    return cp <= 0xFFFF && TTF_GlyphIsProvided(font, static_cast<Uint16>(cp)) != 0;
+#endif
+}
+
+bool GlyphMetrics(TTF_Font* font, std::uint32_t cp, int* minx, int* maxx, int* advance) {
+    int miny = 0;
+    int maxy = 0;
+#if SNAKE_HAS_TTF_GLYPH32
+    return TTF_GlyphMetrics32(font, cp, minx, maxx, &miny, &maxy, advance) == 0;
+#else
+    return TTF_GlyphMetrics(font, static_cast<Uint16>(cp), minx, maxx, &miny, &maxy, advance) == 0;
+#endif
+}
+
+SDL_Surface* RenderGlyph(TTF_Font* font, std::uint32_t cp) {
+    // Rendered white; the draw colour is applied with texture colour/alpha modulation.
+    const SDL_Color white{255, 255, 255, 255};
+#if SNAKE_HAS_TTF_GLYPH32
+    return TTF_RenderGlyph32_Blended(font, cp, white);
+#else
+    return TTF_RenderGlyph_Blended(font, static_cast<Uint16>(cp), white);
+#endif
+}
+
+int Kerning(TTF_Font* font, std::uint32_t prev, std::uint32_t cp) {
+#if SNAKE_HAS_TTF_GLYPH32
+    return TTF_GetFontKerningSizeGlyphs32(font, prev, cp);
+#else
+    if (prev > 0xFFFF || cp > 0xFFFF) {
+        return 0;
+    }
+    return TTF_GetFontKerningSizeGlyphs(font, static_cast<Uint16>(prev), static_cast<Uint16>(cp));
+#endif
+}
+
+}  // namespace
+
+GlyphAtlas::~GlyphAtlas() {
+    Reset();
+}
+
+void GlyphAtlas::Reset() {
+    for (auto& page : pages_) {
+        if (page.texture != nullptr) {
+            SDL_DestroyTexture(page.texture);
+        }
+    }
+    pages_.clear();
+    glyphs_.clear();
+    renderer_ = nullptr;
+    stats_ = {};
+}
+
+void GlyphAtlas::BeginFrame() {
+    stats_.uploads = 0;
+}
+
+const GlyphAtlas::Stats& GlyphAtlas::GetStats() const {
+    return stats_;
+}
+
+bool GlyphAtlas::Pack(SDL_Renderer* r, int w, int h, int* out_page, SDL_Rect* out_rect) {
+    const int pw = w + kPadding;
+    const int ph = h + kPadding;
+    if (pw > kPageSize || ph > kPageSize) {
+        return false;
+    }
+
+    if (!pages_.empty()) {
+        Page& page = pages_.back();
+        if (page.shelf_x + pw > kPageSize) {
+            page.shelf_y += page.shelf_h;
+            page.shelf_x = 0;
+            page.shelf_h = 0;
+        }
+        if (page.shelf_y + ph <= kPageSize) {
+            *out_page = static_cast<int>(pages_.size()) - 1;
+            *out_rect = SDL_Rect{page.shelf_x, page.shelf_y, w, h};
+            page.shelf_x += pw;
+            page.shelf_h = std::max(page.shelf_h, ph);
+            return true;
+        }
+    }
+
+    if (static_cast<int>(pages_.size()) >= kMaxPages) {
+        return false;
+    }
+    SDL_Texture* tex =
+        SDL_CreateTexture(r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+    if (tex == nullptr) {
+        SDL_Log("Glyph atlas: SDL_CreateTexture failed: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    pages_.push_back(Page{tex, pw, 0, ph});
+    stats_.pages = static_cast<int>(pages_.size());
+    *out_page = stats_.pages - 1;
+    *out_rect = SDL_Rect{0, 0, w, h};
+    return true;
+}
+
+const GlyphAtlas::Glyph* GlyphAtlas::Find(SDL_Renderer* r,
+                                          TTF_Font* font,
+                                          int pt_size,
+                                          std::uint32_t codepoint) {
+    const std::uint64_t key = GlyphKey(pt_size, codepoint);
+    if (const auto it = glyphs_.find(key); it != glyphs_.end()) {
+        return &it->second;
+    }
+
+    if (codepoint != kReplacement && !HasGlyph(font, codepoint)) {
+        const Glyph* fallback = Find(r, font, pt_size, kReplacement);
+        if (fallback != nullptr) {
+            glyphs_.emplace(key, *fallback);
+        }
+        return fallback;
+    }
+
+    Glyph glyph;
+    int minx = 0;
+    int maxx = 0;
+    if (!GlyphMetrics(font, codepoint, &minx, &maxx, &glyph.advance)) {
+        return nullptr;
+    }
+    glyph.offset_x = std::min(0, minx);
+
+    if (maxx > minx) {
+        SDL_Surface* surface = RenderGlyph(font, codepoint);
+        if (surface == nullptr) {
+            SDL_Log("Glyph atlas: TTF_RenderGlyph failed for U+%04X: %s",
+                    static_cast<unsigned>(codepoint),
+                    TTF_GetError());
+            return nullptr;
+        }
+        SDL_Surface* argb = surface;
+        if (surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+            argb = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        }
+        bool ok = argb != nullptr && Pack(r, argb->w, argb->h, &glyph.page, &glyph.src);
+        if (ok) {
+            ok = SDL_UpdateTexture(pages_[glyph.page].texture, &glyph.src, argb->pixels, argb->pitch) == 0;
+            ++stats_.uploads;
+        }
+        if (argb != surface && argb != nullptr) {
+            SDL_FreeSurface(argb);
+        }
+        SDL_FreeSurface(surface);
+        if (!ok) {
+            return nullptr;
+        }
+    }
+
+    stats_.glyphs = static_cast<int>(glyphs_.size()) + 1;
+    return &glyphs_.emplace(key, glyph).first->second;
+}
+
+int GlyphAtlas::Draw(SDL_Renderer* r,
+                     TTF_Font* font,
+                     int pt_size,
+                     int x,
+                     int y,
+                     std::string_view text,
+                     SDL_Color color) {
+    if (r == nullptr || font == nullptr) {
+        return -1;
+    }
+    if (r != renderer_) {
+        Reset();
+        renderer_ = r;
+    }
+
+    // Resolve every glyph first so a full atlas never leaves a half-drawn string.
+    run_.clear();
+    int pen_x = x;
+    std::uint32_t prev = 0;
+    for (std::size_t i = 0; i < text.size();) {
+        const std::uint32_t cp = NextCodepoint(text, &i);
+        const Glyph* glyph = Find(r, font, pt_size, cp);
+        if (glyph == nullptr) {
+            return -1;
+        }
+        if (prev != 0) {
+            pen_x += Kerning(font, prev, cp);
+        }
+        if (glyph->page >= 0) {
+            run_.push_back(Placed{glyph, pen_x + glyph->offset_x});
+        }
+        pen_x += glyph->advance;
+        prev = cp;
+    }
+
+    int bound_page = -1;
+    for (const Placed& placed : run_) {
+        const Glyph& glyph = *placed.glyph;
+        SDL_Texture* tex = pages_[glyph.page].texture;
+        if (glyph.page != bound_page) {
+            SDL_SetTextureColorMod(tex, color.r, color.g, color.b);
+            SDL_SetTextureAlphaMod(tex, color.a);
+            bound_page = glyph.page;
+        }
+        const SDL_Rect dst{placed.x, y, glyph.src.w, glyph.src.h};
+        SDL_RenderCopy(r, tex, &glyph.src, &dst);
+    }
+    return TTF_FontHeight(font);
+}
+
+}  // namespace snake::render
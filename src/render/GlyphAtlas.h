@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace snake::render {
+
+// Caches TTF glyphs in shelf-packed textures keyed by (codepoint, point size). A glyph is
+// rasterised and uploaded once, the first time it is drawn; after that a string is a run of
+// SDL_RenderCopy calls from the same texture, which SDL batches. Pages belong to one
+// SDL_Renderer and are dropped when a different renderer is passed in.
+class GlyphAtlas {
+public:
+    struct Stats {
+        int glyphs = 0;
+        int pages = 0;
+        int uploads = 0;  // texture uploads since the last BeginFrame
+    };
+
+    ~GlyphAtlas();
+
+    void Reset();
+    void BeginFrame();
+
+    // Draws UTF-8 `text` with kerning; returns the line height, or -1 if the atlas cannot hold
+    // a glyph (the caller should fall back to per-string rendering).
+    int Draw(SDL_Renderer* r,
+             TTF_Font* font,
+             int pt_size,
+             int x,
+             int y,
+             std::string_view text,
+             SDL_Color color);
+
+    const Stats& GetStats() const;
+
+private:
+    static constexpr int kPageSize = 512;
+    static constexpr int kMaxPages = 4;
+    static constexpr int kPadding = 1;
+
+    struct Glyph {
+        int page = -1;  // -1: nothing to draw (whitespace)
+        SDL_Rect src{0, 0, 0, 0};
+        int offset_x = 0;
+        int advance = 0;
+    };
+
+    struct Page {
+        SDL_Texture* texture = nullptr;
+        int shelf_x = 0;
+        int shelf_y = 0;
+        int shelf_h = 0;
+    };
+
+    struct Placed {
+        const Glyph* glyph = nullptr;
+        int x = 0;
+    };
+
+    const Glyph* Find(SDL_Renderer* r, TTF_Font* font, int pt_size, std::uint32_t codepoint);
+    bool Pack(SDL_Renderer* r, int w, int h, int* out_page, SDL_Rect* out_rect);
+
+    SDL_Renderer* renderer_ = nullptr;
+    std::vector<Page> pages_;
+    std::unordered_map<std::uint64_t, Glyph> glyphs_;  // node-based: Glyph pointers stay valid
+    std::vector<Placed> run_;
+    Stats stats_;
+};
+
+}  // namespace snake::render
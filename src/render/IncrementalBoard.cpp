@@ -0,0 +1,266 @@
+#include "render/IncrementalBoard.h"
+
+#include <algorithm>
+
+namespace snake::render {
+
+IncrementalBoard::~IncrementalBoard() {
+    Reset();
+}
+
+void IncrementalBoard::Reset() {
+    if (texture_ != nullptr) {
+        SDL_DestroyTexture(texture_);
+        texture_ = nullptr;
+    }
+    tex_w_ = 0;
+    tex_h_ = 0;
+    static_layer_ = nullptr;
+    valid_ = false;
+    mirror_.clear();
+    bonuses_.clear();
+    stats_ = {};
+}
+
+SDL_Texture* IncrementalBoard::Texture() const {
+    return texture_;
+}
+
+const IncrementalBoard::Stats& IncrementalBoard::LastStats() const {
+    return stats_;
+}
+
+bool IncrementalBoard::EnsureTexture(SDL_Renderer* r, int w, int h) {
+    if (texture_ != nullptr && tex_w_ == w && tex_h_ == h) {
+        return true;
+    }
+    if (texture_ != nullptr) {
+        SDL_DestroyTexture(texture_);
+    }
+    texture_ = SDL_CreateTexture(r, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, w, h);
+    if (texture_ == nullptr) {
+        SDL_Log("Failed to create incremental board layer (%dx%d): %s", w, h, SDL_GetError());
+        tex_w_ = 0;
+        tex_h_ = 0;
+        return false;
+    }
+    tex_w_ = w;
+    tex_h_ = h;
+    valid_ = false;  // contents undefined: force a full redraw
+    return true;
+}
+
+int IncrementalBoard::Index(snake::game::Pos p) const {
+    if (p.x < 0 || p.y < 0 || p.x >= board_w_ || p.y >= board_h_) {
+        return -1;
+    }
+    return p.y * board_w_ + p.x;
+}
+
+SDL_Rect IncrementalBoard::TileRect(int idx) const {
+    return SDL_Rect{(idx % board_w_) * tile_px_, (idx / board_w_) * tile_px_, tile_px_, tile_px_};
+}
+
+void IncrementalBoard::MarkDirty(snake::game::Pos p) {
+    const int idx = Index(p);
+    if (idx >= 0 && dirty_mark_[idx] == 0) {
+        dirty_mark_[idx] = 1;
+        dirty_.push_back(idx);
+    }
+}
+
+void IncrementalBoard::RebuildMirror(const snake::game::Game& game) {
+    const std::size_t cells = static_cast<std::size_t>(board_w_) * board_h_;
+    drawn_.assign(cells, Cell::Empty);
+    occupancy_.assign(cells, 0);
+    dirty_mark_.assign(cells, 0);
+    dirty_.clear();
+
+    const auto& body = game.GetSnake().Body();
+    mirror_.assign(body.begin(), body.end());
+    for (const auto& p : mirror_) {
+        const int idx = Index(p);
+        if (idx >= 0) {
+            ++occupancy_[idx];
+        }
+        MarkDirty(p);
+    }
+    bonuses_ = game.GetSpawner().Bonuses();
+    for (const auto& bonus : bonuses_) {
+        MarkDirty(bonus.pos);
+    }
+}
+
+bool IncrementalBoard::SyncSnake(const std::deque<snake::game::Pos>& body) {
+    if (mirror_.empty() || body.empty()) {
+        return mirror_.empty() && body.empty();
+    }
+
+    // New head positions are the entries in front of the previously drawn head.
+    const snake::game::Pos prev_head = mirror_.front();
+    std::size_t moved = 0;
+    while (moved < body.size() && moved <= kMaxHeadSteps && body[moved] != prev_head) {
+        ++moved;
+    }
+    if (moved > kMaxHeadSteps || moved == body.size()) {
+        return false;
+    }
+    if (moved > 0) {
+        MarkDirty(prev_head);  // head sprite -> body sprite
+        for (std::size_t i = moved; i > 0; --i) {
+            const snake::game::Pos p = body[i - 1];
+            const int idx = Index(p);
+            if (idx < 0) {
+                return false;
+            }
+            ++occupancy_[idx];
+            mirror_.push_front(p);
+            MarkDirty(p);
+        }
+    }
+
+    while (mirror_.size() > body.size()) {
+        const snake::game::Pos p = mirror_.back();
+        mirror_.pop_back();
+        const int idx = Index(p);
+        if (idx >= 0 && occupancy_[idx] > 0) {
+            --occupancy_[idx];
+        }
+        MarkDirty(p);
+    }
+    return mirror_.size() == body.size() && mirror_.back() == body.back();
+}
+
+void IncrementalBoard::SyncBonuses(const std::vector<snake::game::Bonus>& bonuses) {
+    const bool same = bonuses.size() == bonuses_.size() &&
+                      std::equal(bonuses.begin(), bonuses.end(), bonuses_.begin(), [](const auto& a, const auto& b) {
+                          return a.pos == b.pos && a.type == b.type;
+                      });
+    if (same) {
+        return;
+    }
+    for (const auto& bonus : bonuses_) {
+        MarkDirty(bonus.pos);
+    }
+    for (const auto& bonus : bonuses) {
+        MarkDirty(bonus.pos);
+    }
+    bonuses_ = bonuses;
+}
+
+IncrementalBoard::Cell IncrementalBoard::Desired(int idx, const snake::game::Game& game) const {
+    if (occupancy_[idx] > 0) {
+        return Index(game.GetSnake().Head()) == idx ? Cell::Head : Cell::Body;
+    }
+    for (const auto& bonus : bonuses_) {
+        if (Index(bonus.pos) == idx) {
+            return bonus.type == snake::game::BonusType::Score ? Cell::BonusScore : Cell::BonusSlow;
+        }
+    }
+    return Cell::Empty;
+}
+
+bool IncrementalBoard::Update(SDL_Renderer* r,
+                              SDL_Texture* static_layer,
+                              std::uint64_t static_generation,
+                              int board_w,
+                              int board_h,
+                              int tile_px,
+                              const Sprites& sprites,
+                              const snake::game::Game& game) {
+    stats_ = {};
+    if (r == nullptr || static_layer == nullptr || board_w <= 0 || board_h <= 0 || tile_px <= 0) {
+        return false;
+    }
+    if (!EnsureTexture(r, board_w * tile_px + 1, board_h * tile_px + 1)) {
+        return false;
+    }
+
+    const bool full = !valid_ || static_generation != static_generation_ || board_w != board_w_ ||
+                      board_h != board_h_ || tile_px != tile_px_ || sprites.texture != sprites_.texture;
+    valid_ = true;
+    static_layer_ = static_layer;
+    static_generation_ = static_generation;
+    board_w_ = board_w;
+    board_h_ = board_h;
+    tile_px_ = tile_px;
+    sprites_ = sprites;
+
+    bool rebuild = full;
+    if (!rebuild) {
+        rebuild = !SyncSnake(game.GetSnake().Body());
+        if (!rebuild) {
+            SyncBonuses(game.GetSpawner().Bonuses());
+        }
+    }
+    if (rebuild) {
+        RebuildMirror(game);
+        stats_.full_redraw = true;
+    }
+    if (dirty_.empty()) {
+        return true;
+    }
+
+    // Pass 1: restore the static background of every changed tile. Pass 2: draw the new
+    // contents. Tiles are disjoint, so the two passes batch into two draw calls.
+    redraw_.clear();
+    if (rebuild) {
+        list_.AddSprite(static_layer_, SDL_Rect{0, 0, tex_w_, tex_h_}, SDL_Rect{0, 0, tex_w_, tex_h_},
+                        SDL_Color{255, 255, 255, 255}, SDL_BLENDMODE_NONE);
+    }
+    for (const int idx : dirty_) {
+        dirty_mark_[idx] = 0;
+        const Cell want = Desired(idx, game);
+        if (!rebuild && want == drawn_[idx]) {
+            continue;
+        }
+        const SDL_Rect tile = TileRect(idx);
+        if (!rebuild) {
+            list_.AddSprite(static_layer_, tile, tile, SDL_Color{255, 255, 255, 255}, SDL_BLENDMODE_NONE);
+        }
+        drawn_[idx] = want;
+        if (want != Cell::Empty) {
+            redraw_.push_back(idx);
+        }
+        ++stats_.dirty_tiles;
+    }
+    dirty_.clear();
+
+    for (const int idx : redraw_) {
+        const SDL_Rect tile = TileRect(idx);
+        const SDL_Rect* src = nullptr;
+        SDL_Color fallback{0, 0, 0, 255};
+        switch (drawn_[idx]) {
+            case Cell::Head:
+                src = sprites_.head;
+                fallback = SDL_Color{240, 240, 120, 255};
+                break;
+            case Cell::Body:
+                src = sprites_.body;
+                fallback = SDL_Color{120, 200, 120, 255};
+                break;
+            case Cell::BonusScore:
+                src = sprites_.bonus_score;
+                fallback = SDL_Color{80, 200, 120, 255};
+                break;
+            case Cell::BonusSlow:
+                src = sprites_.bonus_slow;
+                fallback = SDL_Color{80, 200, 120, 255};
+                break;
+            case Cell::Empty:
+                break;
+        }
+        if (src != nullptr && sprites_.texture != nullptr) {
+            list_.AddSprite(sprites_.texture, *src, tile);
+        } else {
+            list_.AddRect(tile, fallback);
+        }
+    }
+
+    SDL_SetRenderTarget(r, texture_);
+    list_.Flush(r);
+    SDL_SetRenderTarget(r, nullptr);
+    return true;
+}
+
+}  // namespace snake::render
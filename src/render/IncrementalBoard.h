@@ -0,0 +1,88 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "game/Game.h"
+#include "render/DrawList.h"
+
+namespace snake::render {
+
+// Persistent board target: static background + grid + pickups + snake. Each frame only the
+// tiles that changed since the last update (new head, old head, vacated tail, bonus cells)
+// are redrawn, so the cost follows the number of moves, not the snake length. Food and
+// animated effects are not part of the layer; the caller composites them on top.
+class IncrementalBoard {
+public:
+    struct Sprites {
+        SDL_Texture* texture = nullptr;
+        const SDL_Rect* head = nullptr;
+        const SDL_Rect* body = nullptr;
+        const SDL_Rect* bonus_score = nullptr;
+        const SDL_Rect* bonus_slow = nullptr;
+    };
+
+    struct Stats {
+        int dirty_tiles = 0;
+        bool full_redraw = false;
+    };
+
+    ~IncrementalBoard();
+
+    // Brings the layer up to date with `game`. `static_layer` holds background + grid at the
+    // same size; `static_generation` changes whenever it is rebuilt (resize, tile or board
+    // size, backdrop), which forces a full redraw. Leaves the default render target bound.
+    // Returns false if the layer is unavailable.
+    bool Update(SDL_Renderer* r,
+                SDL_Texture* static_layer,
+                std::uint64_t static_generation,
+                int board_w,
+                int board_h,
+                int tile_px,
+                const Sprites& sprites,
+                const snake::game::Game& game);
+
+    SDL_Texture* Texture() const;
+    const Stats& LastStats() const;
+    void Reset();
+
+private:
+    enum class Cell : std::uint8_t { Empty, Head, Body, BonusScore, BonusSlow };
+
+    static constexpr std::size_t kMaxHeadSteps = 64;  // more moves than this: full redraw
+
+    bool EnsureTexture(SDL_Renderer* r, int w, int h);
+    void RebuildMirror(const snake::game::Game& game);
+    bool SyncSnake(const std::deque<snake::game::Pos>& body);
+    void SyncBonuses(const std::vector<snake::game::Bonus>& bonuses);
+    Cell Desired(int idx, const snake::game::Game& game) const;
+    void MarkDirty(snake::game::Pos p);
+    int Index(snake::game::Pos p) const;
+    SDL_Rect TileRect(int idx) const;
+
+    SDL_Texture* texture_ = nullptr;
+    int tex_w_ = 0;
+    int tex_h_ = 0;
+    SDL_Texture* static_layer_ = nullptr;
+    std::uint64_t static_generation_ = 0;  // generation the current contents were built from
+    bool valid_ = false;
+    int board_w_ = 0;
+    int board_h_ = 0;
+    int tile_px_ = 0;
+    Sprites sprites_{};
+
+    std::vector<Cell> drawn_;               // what the texture currently shows per tile
+    std::vector<std::uint16_t> occupancy_;  // snake segments per tile (mirror_)
+    std::vector<std::uint8_t> dirty_mark_;
+    std::vector<int> dirty_;
+    std::vector<int> redraw_;
+    std::deque<snake::game::Pos> mirror_;   // snake body as last drawn
+    std::vector<snake::game::Bonus> bonuses_;
+    DrawList list_;
+    Stats stats_;
+};
+
+}  // namespace snake::render
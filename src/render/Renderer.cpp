@@ -1,7 +1,6 @@
 #include "render/Renderer.h"
 
 #include <SDL.h>
-#include <SDL_image.h>
 
 #include <algorithm>
 #include <array>
@@ -26,6 +25,7 @@
 namespace snake::render {
 namespace {
 constexpr int kFallbackTilePx = 32;
+constexpr int kMinZoomedTilePx = 4;
 constexpr int kPanelH = 96;
 constexpr int kPanelW = 280;
 
@@ -122,86 +122,89 @@ void Renderer::DestroyFramebuffer() {
     fb_h_ = 0;
 }
 
-bool Renderer::LoadSprite(SDL_Renderer* r,
-                          const std::filesystem::path& path,
-                          SpriteTexture& sprite,
-                          std::string_view label) {
-    if (r == nullptr) {
-        return false;
+bool Renderer::EnsureBoardLayer(SDL_Renderer* r,
+                                int board_w,
+                                int board_h,
+                                int tile_px,
+                                SDL_Color bg) {
+    const BoardLayerKey key{board_w, board_h, tile_px, bg.r, bg.g, bg.b};
+    if (board_layer_ != nullptr && key == board_layer_key_) {
+        return true;
     }
-
-    if (!std::filesystem::exists(path)) {
-        SDL_Log("Missing sprite '%.*s' at %s", static_cast<int>(label.size()), label.data(), path.string().c_str());
+    if (board_layer_failed_) {
         return false;
     }
+    DestroyBoardLayer();
 
-    SDL_Surface* surface = IMG_Load(path.string().c_str());
-    if (surface == nullptr) {
-        SDL_Log("Failed to load sprite '%.*s' (%s): %s",
-                static_cast<int>(label.size()),
-                label.data(),
-                path.string().c_str(),
-                IMG_GetError());
-        return false;
-    }
-
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(r, surface);
+    const int layer_w = board_w * tile_px + 1;
+    const int layer_h = board_h * tile_px + 1;
+    SDL_Texture* tex = SDL_CreateTexture(r, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, layer_w, layer_h);
     if (tex == nullptr) {
-        SDL_Log("Failed to create texture for '%.*s': %s", static_cast<int>(label.size()), label.data(), SDL_GetError());
-        SDL_FreeSurface(surface);
+        SDL_Log("Failed to create board layer (%dx%d): %s; drawing the grid every frame",
+                layer_w,
+                layer_h,
+                SDL_GetError());
+        board_layer_failed_ = true;
         return false;
     }
-
-    sprite.texture = tex;
-    sprite.w = surface->w;
-    sprite.h = surface->h;
-    SDL_FreeSurface(surface);
-
-    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
 #if SNAKE_HAS_SDL_SCALE_MODE
     SDL_SetTextureScaleMode(tex, SDL_ScaleModeNearest);
-#else
-    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");
 #endif
 
+    SDL_SetRenderTarget(r, tex);
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(r, bg.r, bg.g, bg.b, 255);
+    SDL_RenderClear(r);
+    SDL_SetRenderDrawColor(r, 48, 48, 58, 255);
+    for (int x = 0; x <= board_w; ++x) {
+        SDL_RenderDrawLine(r, x * tile_px, 0, x * tile_px, layer_h - 1);
+    }
+    for (int y = 0; y <= board_h; ++y) {
+        SDL_RenderDrawLine(r, 0, y * tile_px, layer_w - 1, y * tile_px);
+    }
+    SDL_SetRenderTarget(r, nullptr);
+
+    board_layer_ = tex;
+    board_layer_key_ = key;
+    ++board_layer_generation_;
     return true;
 }
 
-void Renderer::ResetSprites() {
-    auto destroy = [](SpriteTexture& sprite) {
-        if (sprite.texture != nullptr) {
-            SDL_DestroyTexture(sprite.texture);
-            sprite.texture = nullptr;
-        }
-        sprite.w = 0;
-        sprite.h = 0;
-    };
+void Renderer::DestroyBoardLayer() {
+    if (board_layer_ != nullptr) {
+        SDL_DestroyTexture(board_layer_);
+        board_layer_ = nullptr;
+    }
+    board_layer_key_ = {};
+}
 
-    destroy(sprites_.snake_head);
-    destroy(sprites_.snake_body);
-    destroy(sprites_.food);
-    destroy(sprites_.bonus_score);
-    destroy(sprites_.bonus_slow);
+void Renderer::InvalidateCaches() {
+    board_cache_.Reset();
+    DestroyBoardLayer();
+    board_layer_failed_ = false;
 }
 
-bool Renderer::Init(SDL_Renderer* r) {
+bool Renderer::Init(SDL_Renderer* r, AssetCache* assets) {
     bool ok = true;
     sprite_error_text_.clear();
-    ResetSprites();
 
-    std::vector<std::string> missing;
-    auto load_sprite = [&](SpriteTexture& sprite, std::string_view label, std::string_view rel_path) {
-        const auto path = snake::io::AssetsPath(std::string(rel_path));
-        if (!LoadSprite(r, path, sprite, label)) {
-            missing.emplace_back(label);
-        }
+    std::vector<SpriteAtlas::Source> sources;
+    auto add_sprite = [&](std::string name, bool optional) {
+        const auto path = snake::io::AssetsPath("sprites/" + name + ".png");
+        sources.push_back(SpriteAtlas::Source{std::move(name), path, optional});
     };
+    add_sprite("snake_head", false);
+    add_sprite("snake_body", false);
+    add_sprite("food", false);
+    add_sprite("bonus_score", false);
+    add_sprite("bonus_slow", false);
+    add_sprite("ui_menu", true);
+    add_sprite("ui_pause", true);
+    add_sprite("ui_restart", true);
+    add_sprite("ui_trophy", true);
 
-    load_sprite(sprites_.snake_head, "snake_head", "sprites/snake_head.png");
-    load_sprite(sprites_.snake_body, "snake_body", "sprites/snake_body.png");
-    load_sprite(sprites_.food, "food", "sprites/food.png");
-    load_sprite(sprites_.bonus_score, "bonus_score", "sprites/bonus_score.png");
-    load_sprite(sprites_.bonus_slow, "bonus_slow", "sprites/bonus_slow.png");
+    std::vector<std::string> missing;
+    sprites_.Build(r, sources, assets, &missing);
 
     if (!missing.empty()) {
         sprite_error_text_ = "Missing sprite";
@@ -229,7 +232,7 @@ bool Renderer::Init(SDL_Renderer* r) {
     font_paths.emplace_back("/usr/share/fonts/truetype/freefont/FreeSans.ttf");
 #endif
 
-    text_renderer_.Init(font_paths, 16);
+    text_renderer_.Init(font_paths, 16, assets);
     ui_.SetTextRenderer(&text_renderer_);
     effects_.Init();
     return ok;
@@ -237,9 +240,11 @@ bool Renderer::Init(SDL_Renderer* r) {
 
 void Renderer::Shutdown() {
     DestroyFramebuffer();
+    InvalidateCaches();
     text_renderer_.Reset();
-    ResetSprites();
+    sprites_.Reset();
     effects_.Reset();
+    camera_.Reset();
     last_render_seconds_ = 0.0;
     sprite_error_text_.clear();
     ui_.SetTextRenderer(nullptr);
@@ -247,6 +252,8 @@ void Renderer::Shutdown() {
 
 void Renderer::ResetEffects() {
     effects_.Reset();
+    // New round: the head starts elsewhere, so the camera jumps to it instead of sliding over.
+    camera_.Reset();
 }
 
 void Renderer::SpawnFoodEat(snake::game::Pos pos, int score_delta) {
@@ -278,16 +285,49 @@ void Renderer::SpawnBonusPickup(snake::game::Pos pos, std::string_view bonus_typ
     }
 }
 
+int Renderer::DrawDebugPanel(SDL_Renderer* r, int x, int y, const DebugLines& lines) {
+    const int padding = kDebugPanelPadding;
+    const int line_gap = 4;
+    const SDL_Color text_color{220, 220, 220, 255};
+    const SDL_Color bg_color{12, 12, 18, 220};
+
+    int max_w = 0;
+    int line_h = 0;
+    for (const auto& line : lines) {
+        const auto metrics = text_renderer_.MeasureText(line, 14, true);
+        max_w = std::max(max_w, metrics.w);
+        line_h = std::max(line_h, metrics.h);
+    }
+
+    const int total_h =
+        static_cast<int>(lines.size()) * line_h + (static_cast<int>(lines.size()) - 1) * line_gap;
+    SDL_Rect bg{x, y, max_w + padding * 2, total_h + padding * 2};
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(r, bg_color.r, bg_color.g, bg_color.b, bg_color.a);
+    SDL_RenderFillRect(r, &bg);
+
+    int cursor_y = bg.y + padding;
+    for (const auto& line : lines) {
+        text_renderer_.DrawText(r, bg.x + padding, cursor_y, line, text_color, 14, true);
+        cursor_y += line_h + line_gap;
+    }
+
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+    return bg.y + bg.h;
+}
+
 void Renderer::RenderFrame(SDL_Renderer* r,
                            int window_w,
                            int window_h,
                            const RenderSettings& rs,
                            const snake::game::Game& game,
                            double now_seconds,
-                           const std::string& overlay_error_text,
+                           std::string_view overlay_error_text,
                            bool show_text_debug,
                            bool show_audio_debug,
-                           const std::vector<std::string>& audio_debug_lines,
+                           const DebugLines& audio_debug_lines,
+                           bool show_lua_debug,
+                           const DebugLines& lua_debug_lines,
                            const snake::render::UiFrameData& ui_frame) {
     if (r == nullptr) {
         return;
@@ -299,8 +339,11 @@ void Renderer::RenderFrame(SDL_Renderer* r,
     }
     last_render_seconds_ = now_seconds;
     effects_.Update(dt_seconds);
+    std::pmr::memory_resource* frame_mem =
+        ui_frame.frame_arena != nullptr ? ui_frame.frame_arena : std::pmr::get_default_resource();
+    text_renderer_.BeginFrame(ui_frame.frame_arena);
 
-    std::string combined_error_text = overlay_error_text;
+    std::pmr::string combined_error_text(overlay_error_text, frame_mem);
     if (!sprite_error_text_.empty()) {
         if (!combined_error_text.empty()) {
             combined_error_text.append(" | ");
@@ -310,7 +353,9 @@ void Renderer::RenderFrame(SDL_Renderer* r,
 
     const std::string mode = NormalizePanelMode(rs.panel_mode);
     bool place_right = (mode == "right");
-    const int tile_px = rs.tile_px > 0 ? rs.tile_px : kFallbackTilePx;
+    const int base_tile_px = rs.tile_px > 0 ? rs.tile_px : kFallbackTilePx;
+    const double zoom = rs.zoom > 0.0 ? rs.zoom : 1.0;
+    const int tile_px = std::max(kMinZoomedTilePx, static_cast<int>(std::lround(base_tile_px * zoom)));
     const int board_w = game.GetBoard().W();
     const int board_h = game.GetBoard().H();
 
@@ -328,12 +373,55 @@ void Renderer::RenderFrame(SDL_Renderer* r,
     }
 
     const bool panel_visible = ui_frame.debug_panel_visible;
-    const int virtual_w = panel_visible ? (place_right ? board_px_w + panel_px_w : board_px_w) : board_px_w;
-    const int virtual_h = panel_visible ? (place_right ? std::max(board_px_h, panel_px_h) : board_px_h + panel_px_h)
-                                        : board_px_h;
+
+    // The play view is the board cut down to the room the window leaves beside the panel, so
+    // the framebuffer never outgrows the window. Larger boards scroll under the camera and
+    // only the visible tiles are drawn.
+    const int room_w = window_w - (panel_visible && place_right ? panel_px_w : 0);
+    const int room_h = window_h - (panel_visible && !place_right ? panel_px_h : 0);
+    const int view_w = std::min(board_px_w, std::max(tile_px, room_w));
+    const int view_h = std::min(board_px_h, std::max(tile_px, room_h));
+
+    SDL_Point focus{board_px_w / 2, board_px_h / 2};
+    if (!game.GetSnake().Body().empty()) {
+        const snake::game::Pos head = game.GetSnake().Head();
+        focus = SDL_Point{head.x * tile_px + tile_px / 2, head.y * tile_px + tile_px / 2};
+    }
+    camera_.Update(dt_seconds, focus, view_w, view_h, board_px_w, board_px_h);
+    const bool scrolling = camera_.Scrolls();
+    const SDL_Point camera_offset = camera_.Offset();
+    const Camera::TileSpan visible_tiles = camera_.VisibleTiles(tile_px, board_w, board_h);
+
+    const int virtual_w = panel_visible ? (place_right ? view_w + panel_px_w : view_w) : view_w;
+    const int virtual_h = panel_visible ? (place_right ? std::max(view_h, panel_px_h) : view_h + panel_px_h)
+                                        : view_h;
 
     const bool have_fb = EnsureFramebuffer(r, virtual_w, virtual_h);
 
+    // Background and grid only change with board size, tile size or backdrop: they are drawn
+    // once into a layer (before the framebuffer is bound) and copied each frame. The layers
+    // are board-sized, so a scrolling view draws the visible tiles directly instead.
+    const bool menu_backdrop = ui_frame.screen == snake::game::Screen::MainMenu ||
+                               ui_frame.screen == snake::game::Screen::Options ||
+                               ui_frame.screen == snake::game::Screen::Highscores ||
+                               ui_frame.screen == snake::game::Screen::NameEntry;
+    const SDL_Color board_bg = menu_backdrop ? SDL_Color{8, 8, 12, 255} : SDL_Color{32, 32, 42, 255};
+    const bool have_board_layer = !scrolling && EnsureBoardLayer(r, board_w, board_h, tile_px, board_bg);
+
+    // Incremental mode: pickups and snake live in a persistent layer where only the tiles
+    // that changed since the last frame are redrawn.
+    bool have_board_cache = false;
+    if (rs.incremental_board && have_board_layer) {
+        IncrementalBoard::Sprites board_sprites;
+        board_sprites.texture = sprites_.Texture();
+        board_sprites.head = sprites_.Get("snake_head");
+        board_sprites.body = sprites_.Get("snake_body");
+        board_sprites.bonus_score = sprites_.Get("bonus_score");
+        board_sprites.bonus_slow = sprites_.Get("bonus_slow");
+        have_board_cache = board_cache_.Update(
+            r, board_layer_, board_layer_generation_, board_w, board_h, tile_px, board_sprites, game);
+    }
+
     SDL_Texture* target = have_fb ? framebuffer_ : nullptr;
     SDL_SetRenderTarget(r, target);
 
@@ -344,100 +432,133 @@ void Renderer::RenderFrame(SDL_Renderer* r,
     SDL_Rect play_rect{};
     if (panel_visible) {
         if (place_right) {
-            panel_rect = SDL_Rect{board_px_w, 0, panel_px_w, std::max(panel_px_h, board_px_h)};
-            play_rect = SDL_Rect{0, 0, board_px_w, board_px_h};
+            panel_rect = SDL_Rect{view_w, 0, panel_px_w, std::max(panel_px_h, view_h)};
+            play_rect = SDL_Rect{0, 0, view_w, view_h};
         } else {
-            panel_rect = SDL_Rect{0, 0, board_px_w, panel_px_h};
-            play_rect = SDL_Rect{0, panel_px_h, board_px_w, board_px_h};
+            panel_rect = SDL_Rect{0, 0, view_w, panel_px_h};
+            play_rect = SDL_Rect{0, panel_px_h, view_w, view_h};
         }
     } else {
         panel_rect = SDL_Rect{0, 0, 0, 0};
-        play_rect = SDL_Rect{0, 0, board_px_w, board_px_h};
+        play_rect = SDL_Rect{0, 0, view_w, view_h};
     }
 
     panel_rect = ClampRectToNonNegative(panel_rect);
     play_rect = ClampRectToNonNegative(play_rect);
 
-    SDL_Point origin{play_rect.x, play_rect.y};
+    // Board pixel (0, 0) in framebuffer coordinates.
+    SDL_Point origin{play_rect.x - camera_offset.x, play_rect.y - camera_offset.y};
+    if (scrolling) {
+        SDL_RenderSetClipRect(r, &play_rect);  // partially visible edge tiles stay off the panel
+    }
 
+    // Board, pickups, food-eat effects and the snake go through the draw list: a few
+    // RenderGeometry calls instead of one SDL call per grid line and segment.
+    draw_list_.ResetStats();
     SDL_Rect board_rect{origin.x, origin.y, board_w * tile_px, board_h * tile_px};
-    if (ui_frame.screen == snake::game::Screen::MainMenu ||
-        ui_frame.screen == snake::game::Screen::Options ||
-        ui_frame.screen == snake::game::Screen::Highscores ||
-        ui_frame.screen == snake::game::Screen::NameEntry) {
-        RenderFallbackRect(r, SDL_Rect{0, 0, virtual_w, virtual_h}, SDL_Color{8, 8, 12, 255});
-    } else {
-        RenderFallbackRect(r, board_rect, SDL_Color{32, 32, 42, 255});
+    if (menu_backdrop) {
+        draw_list_.AddRect(SDL_Rect{0, 0, virtual_w, virtual_h}, board_bg);
     }
 
-    SDL_SetRenderDrawColor(r, 48, 48, 58, 255);
-    for (int x = 0; x <= board_w; ++x) {
-        const int px = origin.x + x * tile_px;
-        SDL_RenderDrawLine(r, px, origin.y, px, origin.y + board_h * tile_px);
-    }
-    for (int y = 0; y <= board_h; ++y) {
-        const int py = origin.y + y * tile_px;
-        SDL_RenderDrawLine(r, origin.x, py, origin.x + board_w * tile_px, py);
+    if (have_board_layer) {
+        const SDL_Rect layer_src{0, 0, board_rect.w + 1, board_rect.h + 1};
+        const SDL_Rect layer_dst{origin.x, origin.y, layer_src.w, layer_src.h};
+        SDL_Texture* layer = have_board_cache ? board_cache_.Texture() : board_layer_;
+        draw_list_.AddSprite(layer, layer_src, layer_dst, SDL_Color{255, 255, 255, 255}, SDL_BLENDMODE_NONE);
+    } else {
+        const SDL_Rect visible_board{origin.x + visible_tiles.x0 * tile_px,
+                                     origin.y + visible_tiles.y0 * tile_px,
+                                     (visible_tiles.x1 - visible_tiles.x0) * tile_px,
+                                     (visible_tiles.y1 - visible_tiles.y0) * tile_px};
+        if (!menu_backdrop) {
+            draw_list_.AddRect(visible_board, board_bg);
+        }
+        const SDL_Color grid_color{48, 48, 58, 255};
+        for (int x = visible_tiles.x0; x <= visible_tiles.x1; ++x) {
+            const int px = origin.x + x * tile_px;
+            draw_list_.AddRect(SDL_Rect{px, visible_board.y, 1, visible_board.h + 1}, grid_color);
+        }
+        for (int y = visible_tiles.y0; y <= visible_tiles.y1; ++y) {
+            const int py = origin.y + y * tile_px;
+            draw_list_.AddRect(SDL_Rect{visible_board.x, py, visible_board.w + 1, 1}, grid_color);
+        }
     }
 
-    if (game.GetSpawner().HasFood()) {
+    SDL_Texture* sprite_tex = sprites_.Texture();
+    if (game.GetSpawner().HasFood() && visible_tiles.Contains(game.GetSpawner().FoodPos())) {
         const snake::game::Pos food_pos = game.GetSpawner().FoodPos();
         const double food_scale = food_pulse_.Eval(now_seconds);
         const int food_size = static_cast<int>(tile_px * food_scale);
         SDL_Rect food_dst = TileRect(origin, tile_px, food_pos, food_size);
-        if (sprites_.food.texture != nullptr) {
+        if (const SDL_Rect* src = sprites_.Get("food")) {
             SDL_Rect dst = food_dst;
             dst.w = tile_px;
             dst.h = tile_px;
-            SDL_RenderCopy(r, sprites_.food.texture, nullptr, &dst);
+            draw_list_.AddSprite(sprite_tex, *src, dst);
         } else {
-            RenderFallbackRect(r, food_dst, SDL_Color{200, 80, 80, 255});
+            draw_list_.AddRect(food_dst, SDL_Color{200, 80, 80, 255});
         }
     }
 
-    for (const auto& bonus : game.GetSpawner().Bonuses()) {
-        SDL_Rect dst = TileRect(origin, tile_px, bonus.pos);
-        SDL_Texture* bonus_tex = nullptr;
-        switch (bonus.type) {
-            case snake::game::BonusType::Score:
-                bonus_tex = sprites_.bonus_score.texture;
-                break;
-            case snake::game::BonusType::Slow:
-                bonus_tex = sprites_.bonus_slow.texture;
-                break;
-        }
+    if (!have_board_cache) {
+        const SDL_Rect* bonus_score_src = sprites_.Get("bonus_score");
+        const SDL_Rect* bonus_slow_src = sprites_.Get("bonus_slow");
+        for (const auto& bonus : game.GetSpawner().Bonuses()) {
+            if (!visible_tiles.Contains(bonus.pos)) {
+                continue;
+            }
+            SDL_Rect dst = TileRect(origin, tile_px, bonus.pos);
+            const SDL_Rect* bonus_src = nullptr;
+            switch (bonus.type) {
+                case snake::game::BonusType::Score:
+                    bonus_src = bonus_score_src;
+                    break;
+                case snake::game::BonusType::Slow:
+                    bonus_src = bonus_slow_src;
+                    break;
+            }
 
-        if (bonus_tex != nullptr) {
-            SDL_RenderCopy(r, bonus_tex, nullptr, &dst);
-        } else {
-            RenderFallbackRect(r, dst, SDL_Color{80, 200, 120, 255});
+            if (bonus_src != nullptr) {
+                draw_list_.AddSprite(sprite_tex, *bonus_src, dst);
+            } else {
+                draw_list_.AddRect(dst, SDL_Color{80, 200, 120, 255});
+            }
         }
     }
 
-    effects_.RenderFoodEats(r, sprites_.food.texture, origin, tile_px);
+    effects_.RenderFoodEats(draw_list_, sprites_, origin, tile_px, play_rect);
 
     const auto& snake = game.GetSnake();
     const auto& body = snake.Body();
     const double head_flash = effects_.HeadFlashStrength();
-    for (std::size_t i = 0; i < body.size(); ++i) {
-        const bool is_head = i == 0;
-        SDL_Rect dst = TileRect(origin, tile_px, body[i]);
-        SDL_Texture* tex = is_head ? sprites_.snake_head.texture : sprites_.snake_body.texture;
-        if (tex != nullptr) {
-            SDL_RenderCopy(r, tex, nullptr, &dst);
-        } else {
-            const SDL_Color color = is_head ? SDL_Color{240, 240, 120, 255} : SDL_Color{120, 200, 120, 255};
-            RenderFallbackRect(r, dst, color);
-        }
-        if (is_head && head_flash > 0.0) {
-            SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_ADD);
-            SDL_SetRenderDrawColor(r, 255, 255, 255, static_cast<Uint8>(std::round(60.0 * head_flash)));
-            SDL_RenderFillRect(r, &dst);
-            SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+    if (!have_board_cache) {
+        const SDL_Rect* head_src = sprites_.Get("snake_head");
+        const SDL_Rect* body_src = sprites_.Get("snake_body");
+        for (std::size_t i = 0; i < body.size(); ++i) {
+            if (!visible_tiles.Contains(body[i])) {
+                continue;
+            }
+            const bool is_head = i == 0;
+            SDL_Rect dst = TileRect(origin, tile_px, body[i]);
+            const SDL_Rect* src = is_head ? head_src : body_src;
+            if (src != nullptr) {
+                draw_list_.AddSprite(sprite_tex, *src, dst);
+            } else {
+                const SDL_Color color = is_head ? SDL_Color{240, 240, 120, 255} : SDL_Color{120, 200, 120, 255};
+                draw_list_.AddRect(dst, color);
+            }
         }
     }
+    if (!body.empty() && head_flash > 0.0 && visible_tiles.Contains(body.front())) {
+        const Uint8 alpha = static_cast<Uint8>(std::round(60.0 * head_flash));
+        draw_list_.AddRect(TileRect(origin, tile_px, body.front()), SDL_Color{255, 255, 255, alpha}, SDL_BLENDMODE_ADD);
+    }
+    draw_list_.Flush(r);
 
-    effects_.RenderFloatingText(r, text_renderer_, origin, tile_px);
+    effects_.RenderFloatingText(r, text_renderer_, origin, tile_px, play_rect);
+    if (scrolling) {
+        SDL_RenderSetClipRect(r, nullptr);
+    }
     SDL_Rect viewport_rect{0, 0, virtual_w, virtual_h};
     effects_.RenderPulse(r, viewport_rect);
 
@@ -477,16 +598,73 @@ void Renderer::RenderFrame(SDL_Renderer* r,
         const SDL_Color text_color{220, 220, 220, 255};
         const SDL_Color bg_color{12, 12, 18, 220};
 
-        const std::string ttf_status = text_renderer_.IsTtfReady() ? "TTF: OK" : "TTF: FAIL";
-        const std::string font_path =
-            text_renderer_.FontPath().empty() ? "n/a" : text_renderer_.FontPath().string();
-        const std::string font_status = text_renderer_.IsFontLoaded()
-                                            ? "Font: OK (" + font_path + ")"
-                                            : "Font: FAIL (" + font_path + ")";
-        const std::string last_error =
-            text_renderer_.LastError().empty() ? "Last error: None" : "Last error: " + text_renderer_.LastError();
+        // Lines are formatted into stack buffers so the overlay itself does not show up in
+        // the heap allocation count it reports.
+        const char* ttf_status = text_renderer_.IsTtfReady() ? "TTF: OK" : "TTF: FAIL";
+        const char* font_path =
+            text_renderer_.FontPathText().empty() ? "n/a" : text_renderer_.FontPathText().c_str();
+        char font_status[320];
+        std::snprintf(font_status,
+                      sizeof(font_status),
+                      "Font: %s (%s)",
+                      text_renderer_.IsFontLoaded() ? "OK" : "FAIL",
+                      font_path);
+        char last_error[320];
+        std::snprintf(last_error,
+                      sizeof(last_error),
+                      "Last error: %s",
+                      text_renderer_.LastError().empty() ? "None" : text_renderer_.LastError().c_str());
+
+        const auto& text_stats = text_renderer_.LastFrameStats();
+        char text_cost[160];
+        std::snprintf(text_cost,
+                      sizeof(text_cost),
+                      "Text: %d strings, %d uploads/frame (atlas: %d glyphs, %d pages), bitmap draws: %d",
+                      text_stats.ttf_strings,
+                      text_stats.texture_uploads,
+                      text_stats.atlas_glyphs,
+                      text_stats.atlas_pages,
+                      text_stats.bitmap_draw_calls);
+
+        const auto& board_stats = draw_list_.GetStats();
+        const auto& cache_stats = board_cache_.LastStats();
+        char board_cost[128];
+        std::snprintf(board_cost,
+                      sizeof(board_cost),
+                      "Board: %d quads, %d draw calls, %d dirty tiles%s, view %dx%d tiles%s",
+                      board_stats.quads,
+                      board_stats.draw_calls,
+                      cache_stats.dirty_tiles,
+                      cache_stats.full_redraw ? " (full)" : "",
+                      visible_tiles.x1 - visible_tiles.x0,
+                      visible_tiles.y1 - visible_tiles.y0,
+                      scrolling ? " (camera)" : "");
+
+        char ui_cost[96];
+        std::snprintf(ui_cost,
+                      sizeof(ui_cost),
+                      "UI: %.3f ms layout+draw, %.3f ms frame data",
+                      ui_.LastRenderMs(),
+                      ui_frame.build_ms);
+
+        char heap_cost[128];
+        if (ui_frame.heap_allocs_last_frame >= 0) {
+            std::snprintf(heap_cost,
+                          sizeof(heap_cost),
+                          "Heap: %lld allocs last frame, arena %zu/%zu KB",
+                          ui_frame.heap_allocs_last_frame,
+                          ui_frame.arena_last_frame_bytes / 1024,
+                          ui_frame.arena_capacity_bytes / 1024);
+        } else {
+            std::snprintf(heap_cost,
+                          sizeof(heap_cost),
+                          "Heap: not counted (SNAKE_COUNT_HEAP_ALLOCS off), arena %zu/%zu KB",
+                          ui_frame.arena_last_frame_bytes / 1024,
+                          ui_frame.arena_capacity_bytes / 1024);
+        }
 
-        const std::array<std::string, 3> lines = {ttf_status, font_status, last_error};
+        const std::array<std::string_view, 7> lines = {
+            ttf_status, font_status, last_error, text_cost, board_cost, ui_cost, heap_cost};
         int max_w = 0;
         int line_h = 0;
         for (const auto& line : lines) {
@@ -510,34 +688,13 @@ void Renderer::RenderFrame(SDL_Renderer* r,
         SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
     }
 
+    int debug_panel_y = kDebugPanelPadding * 2 + 120;
     if (show_audio_debug && !audio_debug_lines.empty()) {
-        const int padding = 8;
-        const int line_gap = 4;
-        const SDL_Color text_color{220, 220, 220, 255};
-        const SDL_Color bg_color{12, 12, 18, 220};
-
-        int max_w = 0;
-        int line_h = 0;
-        for (const auto& line : audio_debug_lines) {
-            const auto metrics = text_renderer_.MeasureText(line, 14, true);
-            max_w = std::max(max_w, metrics.w);
-            line_h = std::max(line_h, metrics.h);
-        }
-
-        const int total_h = static_cast<int>(audio_debug_lines.size()) * line_h +
-                            (static_cast<int>(audio_debug_lines.size()) - 1) * line_gap;
-        SDL_Rect bg{padding, padding * 2 + 120, max_w + padding * 2, total_h + padding * 2};
-        SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(r, bg_color.r, bg_color.g, bg_color.b, bg_color.a);
-        SDL_RenderFillRect(r, &bg);
-
-        int cursor_y = bg.y + padding;
-        for (const auto& line : audio_debug_lines) {
-            text_renderer_.DrawText(r, bg.x + padding, cursor_y, line, text_color, 14, true);
-            cursor_y += line_h + line_gap;
-        }
-
-        SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+        debug_panel_y = DrawDebugPanel(r, kDebugPanelPadding, debug_panel_y, audio_debug_lines);
+        debug_panel_y += kDebugPanelPadding;
+    }
+    if (show_lua_debug && !lua_debug_lines.empty()) {
+        DrawDebugPanel(r, kDebugPanelPadding, debug_panel_y, lua_debug_lines);
     }
 
     SDL_SetRenderTarget(r, nullptr);
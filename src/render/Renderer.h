@@ -2,14 +2,21 @@
 
 #include <SDL.h>
 
+#include <cstdint>
 #include <filesystem>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "game/Game.h"
 #include "render/Animation.h"
+#include "render/AssetCache.h"
+#include "render/Camera.h"
+#include "render/DrawList.h"
 #include "render/Effects.h"
+#include "render/IncrementalBoard.h"
+#include "render/SpriteAtlas.h"
 #include "render/TextRenderer.h"
 #include "render/UIRenderer.h"
 
@@ -18,13 +25,22 @@ namespace snake::render {
 struct RenderSettings {
     int tile_px = 32;
     std::string panel_mode = "auto";  // "auto"|"top"|"right"
+    bool incremental_board = true;    // redraw only changed tiles into a persistent layer
+    double zoom = 1.0;                // multiplier on tile_px; boards larger than the window scroll
 };
 
+// Debug overlay lines; built per frame on the caller's frame arena.
+using DebugLines = std::pmr::vector<std::pmr::string>;
+
 class Renderer {
 public:
-    bool Init(SDL_Renderer* r);
+    // `assets` supplies decoded sprites and fonts; it must outlive the Init/Shutdown cycle so
+    // re-initialising on a new SDL_Renderer only re-uploads textures.
+    bool Init(SDL_Renderer* r, AssetCache* assets = nullptr);
     void Shutdown();
     void ResetEffects();
+    // Drops cached render-target layers; call when SDL reports render targets/device reset.
+    void InvalidateCaches();
     void SpawnFoodEat(snake::game::Pos pos, int score_delta);
     void SpawnBonusPickup(snake::game::Pos pos, std::string_view bonus_type, int score_delta);
 
@@ -34,43 +50,59 @@ public:
                      const RenderSettings& rs,
                      const snake::game::Game& game,
                      double now_seconds,
-                     const std::string& overlay_error_text,
+                     std::string_view overlay_error_text,
                      bool show_text_debug,
                      bool show_audio_debug,
-                     const std::vector<std::string>& audio_debug_lines,
+                     const DebugLines& audio_debug_lines,
+                     bool show_lua_debug,
+                     const DebugLines& lua_debug_lines,
                      const snake::render::UiFrameData& ui_frame);
 
 private:
-    struct SpriteTexture {
-        SDL_Texture* texture = nullptr;
-        int w = 0;
-        int h = 0;
-    };
+    static constexpr int kDebugPanelPadding = 8;
+
+    struct BoardLayerKey {
+        int board_w = 0;
+        int board_h = 0;
+        int tile_px = 0;
+        Uint8 bg_r = 0;
+        Uint8 bg_g = 0;
+        Uint8 bg_b = 0;
 
-    struct SpriteSet {
-        SpriteTexture snake_head;
-        SpriteTexture snake_body;
-        SpriteTexture food;
-        SpriteTexture bonus_score;
-        SpriteTexture bonus_slow;
+        bool operator==(const BoardLayerKey& o) const {
+            return board_w == o.board_w && board_h == o.board_h && tile_px == o.tile_px && bg_r == o.bg_r &&
+                   bg_g == o.bg_g && bg_b == o.bg_b;
+        }
     };
 
     bool EnsureFramebuffer(SDL_Renderer* r, int virtual_w, int virtual_h);
     void DestroyFramebuffer();
-    bool LoadSprite(SDL_Renderer* r,
-                    const std::filesystem::path& path,
-                    SpriteTexture& sprite,
-                    std::string_view label);
-    void ResetSprites();
+    // Background + grid for the current board, rendered once into a target texture.
+    // Leaves the default render target bound.
+    bool EnsureBoardLayer(SDL_Renderer* r,
+                          int board_w,
+                          int board_h,
+                          int tile_px,
+                          SDL_Color bg);
+    void DestroyBoardLayer();
+    // Draws a boxed list of debug lines at (x, y); returns the bottom edge of the box.
+    int DrawDebugPanel(SDL_Renderer* r, int x, int y, const DebugLines& lines);
 
-    SpriteSet sprites_{};
+    SpriteAtlas sprites_;  // game and ui_* sprites packed into one texture
+    DrawList draw_list_;
     std::string sprite_error_text_;
     TextRenderer text_renderer_;
     UIRenderer ui_;
     Pulse food_pulse_;
     Effects effects_;
+    Camera camera_;
 
     SDL_Texture* framebuffer_ = nullptr;
+    SDL_Texture* board_layer_ = nullptr;
+    BoardLayerKey board_layer_key_{};
+    std::uint64_t board_layer_generation_ = 0;  // bumped whenever board_layer_ is redrawn
+    IncrementalBoard board_cache_;
+    bool board_layer_failed_ = false;
     int fb_w_ = 0;
     int fb_h_ = 0;
     double last_render_seconds_ = 0.0;
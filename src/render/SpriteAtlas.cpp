@@ -3,8 +3,27 @@
 #include <SDL_image.h>
 
 #include <algorithm>
+#include <utility>
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+#define SNAKE_HAS_SDL_SCALE_MODE 1
+#else
+#define SNAKE_HAS_SDL_SCALE_MODE 0
+#endif
 
 namespace snake::render {
+namespace {
+constexpr int kPadding = 1;
+constexpr int kMaxAtlasSize = 4096;
+
+int NextPow2(int v) {
+    int p = 1;
+    while (p < v) {
+        p <<= 1;
+    }
+    return p;
+}
+}  // namespace
 
 SpriteAtlas::~SpriteAtlas() {
     ResetTexture();
@@ -64,6 +83,131 @@ bool SpriteAtlas::Load(SDL_Renderer* r, const std::filesystem::path& png_path) {
     return true;
 }
 
+void SpriteAtlas::Reset() {
+    ResetTexture();
+    rects_.clear();
+}
+
+bool SpriteAtlas::Build(SDL_Renderer* r,
+                        const std::vector<Source>& sources,
+                        AssetCache* cache,
+                        std::vector<std::string>* missing) {
+    Reset();
+    if (r == nullptr) {
+        return false;
+    }
+    // Without a shared cache the decoded surfaces only live until the atlas is uploaded.
+    AssetCache local_cache;
+    if (cache == nullptr) {
+        cache = &local_cache;
+    }
+
+    struct Loaded {
+        const Source* source = nullptr;
+        SDL_Surface* surface = nullptr;  // owned by `cache`
+        SDL_Rect rect{0, 0, 0, 0};
+    };
+    std::vector<Loaded> loaded;
+    loaded.reserve(sources.size());
+    long long area = 0;
+    int max_w = 0;
+    for (const auto& source : sources) {
+        const AssetCache::Image& image = cache->LoadImage(source.path);
+        SDL_Surface* surface = image.surface;
+        if (image.exists && surface == nullptr) {
+            SDL_Log("Failed to load sprite '%s' (%s): %s",
+                    source.name.c_str(),
+                    source.path.string().c_str(),
+                    image.error.c_str());
+        } else if (!image.exists && !source.optional) {
+            SDL_Log("Missing sprite '%s' at %s", source.name.c_str(), source.path.string().c_str());
+        }
+        if (surface == nullptr) {
+            if (!source.optional && missing != nullptr) {
+                missing->push_back(source.name);
+            }
+            continue;
+        }
+        area += static_cast<long long>(surface->w + kPadding) * (surface->h + kPadding);
+        max_w = std::max(max_w, surface->w + kPadding);
+        loaded.push_back(Loaded{&source, surface, SDL_Rect{0, 0, surface->w, surface->h}});
+    }
+
+    if (loaded.empty()) {
+        return false;
+    }
+
+    // Shelf packing, tallest first, into a power-of-two wide strip roughly as wide as it is tall.
+    std::vector<Loaded*> order;
+    order.reserve(loaded.size());
+    for (auto& item : loaded) {
+        order.push_back(&item);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Loaded* a, const Loaded* b) {
+        return a->rect.h > b->rect.h;
+    });
+
+    int side = 1;
+    while (static_cast<long long>(side) * side < area) {
+        side <<= 1;
+    }
+    const int atlas_w = std::min(kMaxAtlasSize, std::max(NextPow2(max_w), side));
+    int shelf_x = 0;
+    int shelf_y = 0;
+    int shelf_h = 0;
+    for (Loaded* item : order) {
+        if (shelf_x + item->rect.w + kPadding > atlas_w) {
+            shelf_y += shelf_h;
+            shelf_x = 0;
+            shelf_h = 0;
+        }
+        item->rect.x = shelf_x;
+        item->rect.y = shelf_y;
+        shelf_x += item->rect.w + kPadding;
+        shelf_h = std::max(shelf_h, item->rect.h + kPadding);
+    }
+    const int atlas_h = shelf_y + shelf_h;
+    if (atlas_w > kMaxAtlasSize || atlas_h > kMaxAtlasSize) {
+        SDL_Log("Sprite atlas too large: %dx%d", atlas_w, atlas_h);
+        return false;
+    }
+
+    SDL_Surface* sheet = SDL_CreateRGBSurfaceWithFormat(0, atlas_w, atlas_h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (sheet == nullptr) {
+        SDL_Log("Failed to create sprite atlas surface: %s", SDL_GetError());
+        return false;
+    }
+    SDL_FillRect(sheet, nullptr, 0);
+    for (auto& item : loaded) {
+        // Copy pixels (alpha included) instead of blending onto the empty sheet.
+        SDL_SetSurfaceBlendMode(item.surface, SDL_BLENDMODE_NONE);
+        SDL_Rect dst = item.rect;
+        SDL_BlitSurface(item.surface, nullptr, sheet, &dst);
+    }
+
+    SDL_Texture* tex = SDL_CreateTextureFromSurface(r, sheet);
+    SDL_FreeSurface(sheet);
+    if (tex == nullptr) {
+        SDL_Log("Failed to create sprite atlas texture: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+#if SNAKE_HAS_SDL_SCALE_MODE
+    SDL_SetTextureScaleMode(tex, SDL_ScaleModeNearest);
+#else
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");
+#endif
+
+    texture_ = tex;
+    w_ = atlas_w;
+    h_ = atlas_h;
+    for (const auto& item : loaded) {
+        Define(item.source->name, item.rect);
+    }
+    SDL_Log("Sprite atlas: %zu sprites packed into %dx%d", loaded.size(), w_, h_);
+    return true;
+}
+
 void SpriteAtlas::SetTexture(SDL_Texture* tex) {
     ResetTexture();
     texture_ = tex;
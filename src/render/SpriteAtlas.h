@@ -6,14 +6,32 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
+
+#include "render/AssetCache.h"
 
 namespace snake::render {
 
 class SpriteAtlas {
 public:
+    struct Source {
+        std::string name;
+        std::filesystem::path path;
+        bool optional = false;  // not reported in `missing` when absent
+    };
+
     ~SpriteAtlas();
 
     bool Load(SDL_Renderer* r, const std::filesystem::path& png_path);
+    // Loads every source PNG, shelf-packs them into one texture and defines a rect per name.
+    // Decoded images come from `cache` (nullptr: read from disk and dropped after upload).
+    // Sources that fail to load are skipped; required ones are appended to `missing`.
+    // Returns false if no texture could be built.
+    bool Build(SDL_Renderer* r,
+               const std::vector<Source>& sources,
+               AssetCache* cache,
+               std::vector<std::string>* missing);
+    void Reset();
     void SetTexture(SDL_Texture* tex);  // optional internal
     SDL_Texture* Texture() const;
 
@@ -3,8 +3,16 @@
 #include <SDL_ttf.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <string>
 
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+#define SNAKE_HAS_SDL_SCALE_MODE 1
+#else
+#define SNAKE_HAS_SDL_SCALE_MODE 0
+#endif
+
 namespace snake::render {
 namespace {
 constexpr int kGlyphW = 5;
@@ -111,6 +119,18 @@ constexpr unsigned char kFont5x7[96][5] = {
     {0x08, 0x1C, 0x2A, 0x08, 0x08},  // 127
 };
 
+constexpr int kGlyphCount = 96;
+// Baked strip: glyph i sits at x = i * kCellW; the 1 px gap keeps scaled copies from bleeding.
+constexpr int kCellW = kGlyphW + 1;
+
+unsigned char BitmapGlyphIndex(char c) {
+    unsigned char glyph = static_cast<unsigned char>(c);
+    if (glyph < 32 || glyph > 127) {
+        glyph = '?';
+    }
+    return static_cast<unsigned char>(glyph - 32);
+}
+
 int PixelScaleFromSize(int pixel_size) {
     if (pixel_size <= 0) {
         return 1;
@@ -119,7 +139,7 @@ int PixelScaleFromSize(int pixel_size) {
 }
 }  // namespace
 
-bool TextRenderer::Init(const std::vector<std::filesystem::path>& font_paths, int pt_size) {
+bool TextRenderer::Init(const std::vector<std::filesystem::path>& font_paths, int pt_size, AssetCache* cache) {
     Reset();
     font_pt_size_ = pt_size;
     ttf_ready_ = TTF_WasInit() != 0;
@@ -132,9 +152,11 @@ bool TextRenderer::Init(const std::vector<std::filesystem::path>& font_paths, in
     bool loaded = false;
     for (const auto& path : font_paths) {
         font_path_ = path;
-        const std::string resolved = path.string();
-        SDL_Log("Attempting to load font: %s", resolved.c_str());
-        if (!font_.Load(path, pt_size)) {
+        // string() is the ANSI code page on Windows; SDL_Log and the UI expect UTF-8.
+        const auto utf8 = path.u8string();
+        font_path_text_.assign(utf8.begin(), utf8.end());
+        SDL_Log("Attempting to load font: %s", font_path_text_.c_str());
+        if (!font_.Load(path, pt_size, cache)) {
             last_error_ = font_.LastError();
             continue;
         }
@@ -143,7 +165,7 @@ bool TextRenderer::Init(const std::vector<std::filesystem::path>& font_paths, in
     }
 
     if (!loaded && !font_paths.empty()) {
-        SDL_Log("No font loaded. Last attempt: %s", font_path_.string().c_str());
+        SDL_Log("No font loaded. Last attempt: %s", font_path_text_.c_str());
         if (last_error_.empty()) {
             last_error_ = "Font file not found";
         }
@@ -153,10 +175,13 @@ bool TextRenderer::Init(const std::vector<std::filesystem::path>& font_paths, in
 }
 
 void TextRenderer::Reset() {
+    atlas_.Reset();
+    DestroyBitmapTexture();
     font_.Reset();
     ttf_ready_ = false;
     font_pt_size_ = 0;
     font_path_.clear();
+    font_path_text_.clear();
     last_error_.clear();
 }
 
@@ -172,10 +197,29 @@ const std::filesystem::path& TextRenderer::FontPath() const {
     return font_path_;
 }
 
+const std::string& TextRenderer::FontPathText() const {
+    return font_path_text_;
+}
+
 const std::string& TextRenderer::LastError() const {
     return last_error_;
 }
 
+void TextRenderer::BeginFrame(std::pmr::memory_resource* scratch) {
+    font_.SetScratch(scratch);
+    const GlyphAtlas::Stats& atlas = atlas_.GetStats();
+    frame_stats_.texture_uploads += atlas.uploads;
+    frame_stats_.atlas_glyphs = atlas.glyphs;
+    frame_stats_.atlas_pages = atlas.pages;
+    last_frame_stats_ = frame_stats_;
+    frame_stats_ = {};
+    atlas_.BeginFrame();
+}
+
+const TextRenderer::FrameStats& TextRenderer::LastFrameStats() const {
+    return last_frame_stats_;
+}
+
 TextRenderer::Metrics TextRenderer::MeasureText(std::string_view text, int pixel_size, bool force_bitmap) const {
     if (force_bitmap || !ttf_ready_ || !font_.IsLoaded()) {
         return MeasureBitmap(text, pixel_size);
@@ -215,6 +259,13 @@ int TextRenderer::DrawText(SDL_Renderer* r,
         return DrawBitmap(r, x, y, text, color, pixel_size);
     }
 
+    ++frame_stats_.ttf_strings;
+    const int atlas_h = atlas_.Draw(r, font_.Handle(), font_.PtSize(), x, y, text, color);
+    if (atlas_h >= 0) {
+        return atlas_h;
+    }
+
+    // Atlas full or glyph failed: rasterise the whole string as before.
     int w = 0;
     int h = 0;
     SDL_Texture* tex = font_.RenderText(r, text, color, &w, &h);
@@ -222,6 +273,7 @@ int TextRenderer::DrawText(SDL_Renderer* r,
         RecordError(font_.LastError());
         return DrawBitmap(r, x, y, text, color, pixel_size);
     }
+    ++frame_stats_.texture_uploads;
 
     SDL_Rect dst{x, y, w, h};
     SDL_RenderCopy(r, tex, nullptr, &dst);
@@ -236,25 +288,86 @@ TextRenderer::Metrics TextRenderer::MeasureBitmap(std::string_view text, int pix
     return Metrics{static_cast<int>(text.size()) * char_w, char_h};
 }
 
+bool TextRenderer::EnsureBitmapTexture(SDL_Renderer* r) const {
+    if (bitmap_texture_ != nullptr && bitmap_renderer_ == r) {
+        return true;
+    }
+    DestroyBitmapTexture();
+
+    // White glyphs on transparent; colour comes from texture colour/alpha modulation.
+    constexpr int tex_w = kGlyphCount * kCellW;
+    std::array<std::uint32_t, tex_w * kGlyphH> pixels{};
+    for (int g = 0; g < kGlyphCount; ++g) {
+        for (int col = 0; col < kGlyphW; ++col) {
+            const unsigned char bits = kFont5x7[g][col];
+            for (int row = 0; row < kGlyphH; ++row) {
+                if (bits & (1 << row)) {
+                    pixels[row * tex_w + g * kCellW + col] = 0xFFFFFFFFu;
+                }
+            }
+        }
+    }
+
+    SDL_Texture* tex =
+        SDL_CreateTexture(r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, tex_w, kGlyphH);
+    if (tex == nullptr || SDL_UpdateTexture(tex, nullptr, pixels.data(), tex_w * 4) != 0) {
+        SDL_Log("Bitmap font texture failed: %s; using per-pixel fallback", SDL_GetError());
+        if (tex != nullptr) {
+            SDL_DestroyTexture(tex);
+        }
+        return false;
+    }
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+#if SNAKE_HAS_SDL_SCALE_MODE
+    SDL_SetTextureScaleMode(tex, SDL_ScaleModeNearest);
+#endif
+    bitmap_texture_ = tex;
+    bitmap_renderer_ = r;
+    return true;
+}
+
+void TextRenderer::DestroyBitmapTexture() const {
+    if (bitmap_texture_ != nullptr) {
+        SDL_DestroyTexture(bitmap_texture_);
+        bitmap_texture_ = nullptr;
+    }
+    bitmap_renderer_ = nullptr;
+}
+
 int TextRenderer::DrawBitmap(SDL_Renderer* r, int x, int y, std::string_view text, SDL_Color color, int pixel_size) const {
     const int scale = PixelScaleFromSize(pixel_size);
     const int char_w = (kGlyphW + kGlyphSpacing) * scale;
     const int char_h = kGlyphH * scale;
+
+    if (EnsureBitmapTexture(r)) {
+        SDL_SetTextureColorMod(bitmap_texture_, color.r, color.g, color.b);
+        SDL_SetTextureAlphaMod(bitmap_texture_, color.a);
+        int cursor_x = x;
+        for (char c : text) {
+            if (c != ' ') {
+                const int g = BitmapGlyphIndex(c);
+                const SDL_Rect src{g * kCellW, 0, kGlyphW, kGlyphH};
+                const SDL_Rect dst{cursor_x, y, kGlyphW * scale, char_h};
+                SDL_RenderCopy(r, bitmap_texture_, &src, &dst);
+                ++frame_stats_.bitmap_draw_calls;
+            }
+            cursor_x += char_w;
+        }
+        return char_h;
+    }
+
     SDL_SetRenderDrawColor(r, color.r, color.g, color.b, color.a);
 
     int cursor_x = x;
     for (char c : text) {
-        unsigned char glyph = static_cast<unsigned char>(c);
-        if (glyph < 32 || glyph > 127) {
-            glyph = '?';
-        }
-        const unsigned char* cols = kFont5x7[glyph - 32];
+        const unsigned char* cols = kFont5x7[BitmapGlyphIndex(c)];
         for (int col = 0; col < kGlyphW; ++col) {
             unsigned char bits = cols[col];
             for (int row = 0; row < kGlyphH; ++row) {
                 if (bits & (1 << row)) {
                     SDL_Rect px{cursor_x + col * scale, y + row * scale, scale, scale};
                     SDL_RenderFillRect(r, &px);
+                    ++frame_stats_.bitmap_draw_calls;
                 }
             }
         }
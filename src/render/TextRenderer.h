@@ -3,11 +3,13 @@
 #include <SDL.h>
 
 #include <filesystem>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "render/Font.h"
+#include "render/GlyphAtlas.h"
 
 namespace snake::render {
 
@@ -18,14 +20,32 @@ public:
         int h = 0;
     };
 
-    bool Init(const std::vector<std::filesystem::path>& font_paths, int pt_size);
+    // Per-frame text cost. Without the glyph atlas every TTF string was one texture upload, so
+    // `ttf_strings` is the old upload count and `texture_uploads` the current one.
+    // `bitmap_draw_calls` counts copies from the baked 5x7 font (FillRects on fallback).
+    struct FrameStats {
+        int ttf_strings = 0;
+        int texture_uploads = 0;
+        int bitmap_draw_calls = 0;
+        int atlas_glyphs = 0;
+        int atlas_pages = 0;
+    };
+
+    // Fonts are opened through `cache` when given, so a re-Init does not touch the disk.
+    bool Init(const std::vector<std::filesystem::path>& font_paths, int pt_size, AssetCache* cache = nullptr);
     void Reset();
 
     bool IsTtfReady() const;
     bool IsFontLoaded() const;
     const std::filesystem::path& FontPath() const;
+    const std::string& FontPathText() const;  // FontPath() as UTF-8, for display
     const std::string& LastError() const;
 
+    // Closes the current frame's counters (readable via LastFrameStats) and starts new ones.
+    // `scratch` backs per-call temporaries until the next BeginFrame (nullptr: heap).
+    void BeginFrame(std::pmr::memory_resource* scratch = nullptr);
+    const FrameStats& LastFrameStats() const;
+
     Metrics MeasureText(std::string_view text, int pixel_size, bool force_bitmap = false) const;
     int DrawText(SDL_Renderer* r,
                  int x,
@@ -38,12 +58,21 @@ public:
 private:
     Metrics MeasureBitmap(std::string_view text, int pixel_size) const;
     int DrawBitmap(SDL_Renderer* r, int x, int y, std::string_view text, SDL_Color color, int pixel_size) const;
+    // Bakes kFont5x7 into a white texture for `r` (rebuilt if the renderer changes).
+    bool EnsureBitmapTexture(SDL_Renderer* r) const;
+    void DestroyBitmapTexture() const;
     void RecordError(std::string message) const;
 
     Font font_;
+    mutable GlyphAtlas atlas_;
+    mutable SDL_Texture* bitmap_texture_ = nullptr;  // owned
+    mutable SDL_Renderer* bitmap_renderer_ = nullptr;
+    mutable FrameStats frame_stats_;
+    FrameStats last_frame_stats_;
     bool ttf_ready_ = false;
     int font_pt_size_ = 0;
     std::filesystem::path font_path_;
+    std::string font_path_text_;
     mutable std::string last_error_;
 };
 
@@ -4,9 +4,12 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
-#include <sstream>
+#include <cstdio>
+#include <initializer_list>
 #include <string>
+#include <vector>
 
 #include "game/Effects.h"
 #include "game/Game.h"
@@ -47,10 +50,67 @@ int MeasureTextHeight(TextRenderer* renderer, int size) {
     return renderer->MeasureText("Ag", size).h;
 }
 
+// Concatenates `parts` on the frame arena (default resource when the caller has none).
+std::pmr::string FrameConcat(const UiFrameData& ui, std::initializer_list<std::string_view> parts) {
+    std::pmr::string out(ui.frame_arena != nullptr ? ui.frame_arena : std::pmr::get_default_resource());
+    std::size_t size = 0;
+    for (const auto part : parts) {
+        size += part.size();
+    }
+    out.reserve(size);
+    for (const auto part : parts) {
+        out.append(part);
+    }
+    return out;
+}
+
+const char* ScreenLabel(snake::game::Screen screen) {
+    switch (screen) {
+        case snake::game::Screen::MainMenu: return "Menu";
+        case snake::game::Screen::Options: return "Options";
+        case snake::game::Screen::Highscores: return "Highscores";
+        case snake::game::Screen::Playing: return "Playing";
+        case snake::game::Screen::Paused: return "Paused";
+        case snake::game::Screen::GameOver: return "Game Over";
+        case snake::game::Screen::NameEntry: return "Name Entry";
+    }
+    return "";
+}
+
+int SlowTenths(const snake::game::Effects& effects) {
+    if (!effects.SlowActive()) {
+        return -1;
+    }
+    return static_cast<int>(std::lround(std::max(0.0, static_cast<double>(effects.SlowRemaining())) * 10.0));
+}
+
 }  // namespace
 
 void UIRenderer::SetTextRenderer(TextRenderer* text_renderer) {
     text_renderer_ = text_renderer;
+    InvalidateCaches();
+}
+
+double UIRenderer::LastRenderMs() const {
+    return last_render_ms_;
+}
+
+void UIRenderer::InvalidateCaches() {
+    hud_cache_.valid = false;
+    panel_cache_.valid = false;
+    highscores_cache_.valid = false;
+    score_line_cache_.valid = false;
+}
+
+const std::string& UIRenderer::ScoreLine(int score) {
+    if (!score_line_cache_.valid || score_line_cache_.score != score) {
+        score_line_cache_.valid = true;
+        score_line_cache_.score = score;
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "Score: %d", score);
+        score_line_cache_.text = buf;
+    }
+    return score_line_cache_.text;
 }
 
 void UIRenderer::Render(SDL_Renderer* r,
@@ -58,6 +118,7 @@ void UIRenderer::Render(SDL_Renderer* r,
                         const snake::game::Game& game,
                         double /*now_seconds*/,
                         const UiFrameData& ui) {
+    const auto start = std::chrono::steady_clock::now();
     SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
 
     switch (ui.screen) {
@@ -100,37 +161,35 @@ void UIRenderer::Render(SDL_Renderer* r,
         int cursor_x = panel_rect.x + l.padding;
         int cursor_y = panel_rect.y + l.padding;
 
-        std::ostringstream top_line;
-        top_line << "State: ";
-        switch (ui.screen) {
-            case snake::game::Screen::MainMenu: top_line << "Menu"; break;
-            case snake::game::Screen::Options: top_line << "Options"; break;
-            case snake::game::Screen::Highscores: top_line << "Highscores"; break;
-            case snake::game::Screen::Playing: top_line << "Playing"; break;
-            case snake::game::Screen::Paused: top_line << "Paused"; break;
-            case snake::game::Screen::GameOver: top_line << "Game Over"; break;
-            case snake::game::Screen::NameEntry: top_line << "Name Entry"; break;
+        const int score = game.GetScore().Score();
+        const int slow_tenths = SlowTenths(game.GetEffects());
+        PanelCache& pc = panel_cache_;
+        // Formatted into stack buffers and assigned, so a change reuses the string capacity.
+        char buf[96];
+        if (!pc.valid || pc.screen != ui.screen || pc.score != score) {
+            std::snprintf(buf, sizeof(buf), "State: %s   Score: %d", ScreenLabel(ui.screen), score);
+            pc.top_line = buf;
+            pc.screen = ui.screen;
+            pc.score = score;
         }
-        top_line << "   Score: " << game.GetScore().Score();
+        if (!pc.valid || pc.slow_tenths != slow_tenths) {
+            if (slow_tenths >= 0) {
+                std::snprintf(buf, sizeof(buf), "Slow: %.1fs remaining", slow_tenths / 10.0);
+                pc.effects_line = buf;
+            } else {
+                pc.effects_line = "Slow: inactive";
+            }
+            pc.slow_tenths = slow_tenths;
+        }
+        pc.valid = true;
 
-        const int top_h = DrawTextLine(r, cursor_x, cursor_y, top_line.str());
+        const int top_h = DrawTextLine(r, cursor_x, cursor_y, pc.top_line);
         cursor_y += top_h + l.line_gap;
 
-        std::ostringstream effects_line;
-        const auto& effects = game.GetEffects();
-        effects_line << "Slow: ";
-        if (effects.SlowActive()) {
-            effects_line.setf(std::ios::fixed);
-            effects_line.precision(1);
-            effects_line << effects.SlowRemaining() << "s remaining";
-        } else {
-            effects_line << "inactive";
-        }
-        const int effects_h = DrawTextLine(r, cursor_x, cursor_y, effects_line.str());
+        const int effects_h = DrawTextLine(r, cursor_x, cursor_y, pc.effects_line);
         cursor_y += effects_h + l.line_gap;
 
-        std::string hints = "Enter: Select  |  Esc: Back  |  P: Pause  |  R: Restart";
-        DrawTextLine(r, cursor_x, cursor_y, hints);
+        DrawTextLine(r, cursor_x, cursor_y, "Enter: Select  |  Esc: Back  |  P: Pause  |  R: Restart");
 
         if (!ui.ui_message.empty()) {
             cursor_y += top_h + l.line_gap;
@@ -138,9 +197,12 @@ void UIRenderer::Render(SDL_Renderer* r,
         }
         if (!ui.lua_error.empty()) {
             cursor_y += top_h + l.line_gap;
-            DrawTextLine(r, cursor_x, cursor_y, "Lua: " + ui.lua_error);
+            DrawTextLine(r, cursor_x, cursor_y, FrameConcat(ui, {"Lua: ", ui.lua_error}));
         }
     }
+
+    last_render_ms_ =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
 
 int UIRenderer::DrawTextLine(SDL_Renderer* r, int x, int y, std::string_view s) {
@@ -165,16 +227,20 @@ void UIRenderer::RenderMenu(SDL_Renderer* r, const Layout& l, const UiFrameData&
     const int item_w = 240;
     const int item_h = 32;
     const int gap = 12;
-    const int total_h = static_cast<int>(ui.menu_items.size()) * (item_h + gap);
+    if (ui.menu_items == nullptr) {
+        return;
+    }
+    const auto& items = *ui.menu_items;
+    const int total_h = static_cast<int>(items.size()) * (item_h + gap);
     int y = (l.window_h - total_h) / 2;
     int x = (l.window_w - item_w) / 2;
 
-    for (std::size_t i = 0; i < ui.menu_items.size(); ++i) {
+    for (std::size_t i = 0; i < items.size(); ++i) {
         SDL_Rect rect{x, y, item_w, item_h};
         const bool sel = static_cast<int>(i) == ui.menu_index;
         SDL_SetRenderDrawColor(r, sel ? 60 : 32, sel ? 80 : 32, sel ? 120 : 48, 230);
         SDL_RenderFillRect(r, &rect);
-        DrawTextLine(r, x + 10, y + 6, ui.menu_items[i]);
+        DrawTextLine(r, x + 10, y + 6, items[i]);
         y += item_h + gap;
     }
 }
@@ -183,6 +249,10 @@ void UIRenderer::RenderOptions(SDL_Renderer* r, const Layout& l, const UiFrameDa
     SDL_Rect backdrop{0, 0, l.window_w, l.window_h};
     SDL_SetRenderDrawColor(r, 8, 8, 12, 230);
     SDL_RenderFillRect(r, &backdrop);
+    if (ui.option_items == nullptr) {
+        return;
+    }
+    const auto& items = *ui.option_items;
 
     const int start_x = l.padding * 2;
     const int row_h = 24;
@@ -195,7 +265,7 @@ void UIRenderer::RenderOptions(SDL_Renderer* r, const Layout& l, const UiFrameDa
     const int list_area_h = std::max(0, list_bottom - list_top);
     const int item_h = row_h + gap;
     const int visible_rows = std::max(1, list_area_h / item_h);
-    const int max_scroll = std::max(0, static_cast<int>(ui.option_items.size()) - visible_rows);
+    const int max_scroll = std::max(0, static_cast<int>(items.size()) - visible_rows);
     const int center_row = visible_rows / 2;
     const int scroll_index =
         std::clamp(ui.options_index - center_row, 0, max_scroll);
@@ -205,10 +275,10 @@ void UIRenderer::RenderOptions(SDL_Renderer* r, const Layout& l, const UiFrameDa
     y = list_top;
 
     const int end_index =
-        std::min(static_cast<int>(ui.option_items.size()),
+        std::min(static_cast<int>(items.size()),
                  scroll_index + visible_rows);
     for (int i = scroll_index; i < end_index; ++i) {
-        const auto& [label, value] = ui.option_items[i];
+        const auto& [label, value] = items[i];
         const bool sel = i == ui.options_index;
         if (sel) {
             SDL_Rect hilite{start_x - 6, y - 2, l.window_w - start_x * 2, row_h + 4};
@@ -221,9 +291,12 @@ void UIRenderer::RenderOptions(SDL_Renderer* r, const Layout& l, const UiFrameDa
     }
 
     if (ui.rebinding) {
-        std::ostringstream msg;
-        msg << "Rebinding " << ui.rebind_action << " slot " << (ui.rebind_slot + 1) << " - press allowed key";
-        DrawTextLine(r, start_x, y + gap, msg.str());
+        char slot[16];
+        std::snprintf(slot, sizeof(slot), "%d", ui.rebind_slot + 1);
+        DrawTextLine(r,
+                     start_x,
+                     y + gap,
+                     FrameConcat(ui, {"Rebinding ", ui.rebind_action, " slot ", slot, " - press allowed key"}));
     } else {
         DrawTextLine(r, start_x, y + gap, "Up/Down: select  |  Left/Right: adjust  |  Confirm: toggle/edit  |  Esc/Menu: Back");
     }
@@ -242,39 +315,58 @@ void UIRenderer::RenderGameHud(SDL_Renderer* r,
     }
 
     const int font_size = 16;
-    const int line_h = MeasureTextHeight(text_renderer_, font_size);
     const int line_gap = 6;
     const int padding = 12;
 
-    std::ostringstream score_line;
-    score_line << "Score: " << game.GetScore().Score();
-
-    std::ostringstream speed_line;
-    speed_line.setf(std::ios::fixed);
-    speed_line.precision(2);
-    speed_line << "Speed: " << std::max(0.0, ui.effective_tps) << " tps";
-
-    std::ostringstream slow_line;
-    const auto& effects = game.GetEffects();
-    slow_line << "Slow: ";
-    if (effects.SlowActive()) {
-        slow_line.setf(std::ios::fixed);
-        slow_line.precision(1);
-        slow_line << effects.SlowRemaining() << "s";
-    } else {
-        slow_line << "inactive";
-    }
-
-    const std::array<std::string, 3> lines = {
-        score_line.str(),
-        speed_line.str(),
-        slow_line.str()
-    };
+    // Lines are keyed on their displayed precision, so the text only changes when a value
+    // visibly does.
+    const int score = game.GetScore().Score();
+    const long long tps_centi = std::llround(std::max(0.0, ui.effective_tps) * 100.0);
+    const int slow_tenths = SlowTenths(game.GetEffects());
+    const bool sim = ui.time_scale > 1.0;
+    const long long sim_scale = sim ? std::llround(ui.time_scale) : 0;
+    const long long sim_tps = sim ? std::llround(std::max(0.0, ui.achieved_tps)) : 0;
+
+    HudCache& hc = hud_cache_;
+    if (!hc.valid || hc.score != score || hc.tps_centi != tps_centi || hc.slow_tenths != slow_tenths ||
+        hc.sim != sim || hc.sim_scale != sim_scale || hc.sim_tps != sim_tps) {
+        // Lines are overwritten in place (snprintf + assign), so once the strings have grown
+        // to their working size an update does not allocate.
+        hc.lines.resize(sim ? 4 : 3);
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), "Score: %d", score);
+        hc.lines[0] = buf;
+        std::snprintf(buf, sizeof(buf), "Speed: %.2f tps", tps_centi / 100.0);
+        hc.lines[1] = buf;
+        if (slow_tenths >= 0) {
+            std::snprintf(buf, sizeof(buf), "Slow: %.1fs", slow_tenths / 10.0);
+            hc.lines[2] = buf;
+        } else {
+            hc.lines[2] = "Slow: inactive";
+        }
+        if (sim) {
+            std::snprintf(buf, sizeof(buf), "Sim: %lldx  (%lld ticks/s)", sim_scale, sim_tps);
+            hc.lines[3] = buf;
+        }
 
-    int max_w = 0;
-    for (const auto& line : lines) {
-        max_w = std::max(max_w, MeasureTextWidth(text_renderer_, line, font_size));
+        if (!hc.valid) {
+            hc.line_h = MeasureTextHeight(text_renderer_, font_size);
+        }
+        hc.max_w = 0;
+        for (const auto& line : hc.lines) {
+            hc.max_w = std::max(hc.max_w, MeasureTextWidth(text_renderer_, line, font_size));
+        }
+        hc.valid = true;
+        hc.score = score;
+        hc.tps_centi = tps_centi;
+        hc.slow_tenths = slow_tenths;
+        hc.sim = sim;
+        hc.sim_scale = sim_scale;
+        hc.sim_tps = sim_tps;
     }
+    const std::vector<std::string>& lines = hc.lines;
+    const int line_h = hc.line_h;
+    const int max_w = hc.max_w;
 
     const int hud_w = max_w + padding * 2;
     const int hud_h = static_cast<int>(lines.size()) * line_h +
@@ -298,15 +390,13 @@ void UIRenderer::RenderGameHud(SDL_Renderer* r,
     }
 }
 
-void UIRenderer::RenderHighscores(SDL_Renderer* r, const Layout& l, const UiFrameData& ui) {
-    SDL_Rect backdrop{0, 0, l.window_w, l.window_h};
-    SDL_SetRenderDrawColor(r, 10, 10, 16, 230);
-    SDL_RenderFillRect(r, &backdrop);
-
-    SDL_Rect content_rect = l.play_rect;
-    if (content_rect.w <= 0 || content_rect.h <= 0) {
-        content_rect = SDL_Rect{0, 0, l.window_w, l.window_h};
-    }
+void UIRenderer::BuildHighscores(const SDL_Rect& content_rect, const UiFrameData& ui) {
+    HighscoresCache& hc = highscores_cache_;
+    hc.valid = true;
+    hc.content = content_rect;
+    hc.revision = ui.highscores_revision;
+    hc.entries = ui.highscores;
+    hc.rows.clear();
 
     const int font_size = 16;
     const int line_h = MeasureTextHeight(text_renderer_, font_size);
@@ -349,20 +439,16 @@ void UIRenderer::RenderHighscores(SDL_Renderer* r, const Layout& l, const UiFram
     const int panel_h = total_h;
     const int panel_x = content_rect.x + std::max(0, (content_rect.w - panel_w) / 2);
     const int panel_y = content_rect.y + std::max(0, (content_rect.h - panel_h) / 2);
-    SDL_Rect panel{panel_x, panel_y, panel_w, panel_h};
-
-    SDL_SetRenderDrawColor(r, 18, 18, 26, 220);
-    SDL_RenderFillRect(r, &panel);
-    SDL_SetRenderDrawColor(r, 70, 80, 96, 200);
-    SDL_RenderDrawRect(r, &panel);
+    const SDL_Rect panel{panel_x, panel_y, panel_w, panel_h};
+    hc.panel = panel;
 
     int cursor_x = panel.x + inner_pad;
     int cursor_y = panel.y + inner_pad;
 
     const std::string title = "Highscores";
     const int title_w = MeasureTextWidth(text_renderer_, title, font_size);
-    const int title_x = panel.x + std::max(0, (panel.w - title_w) / 2);
-    DrawTextLine(r, title_x, cursor_y, title);
+    hc.title = HighscoreCell{panel.x + std::max(0, (panel.w - title_w) / 2), title};
+    hc.title_y = cursor_y;
     cursor_y += title_h + section_gap;
 
     const int table_x = cursor_x;
@@ -412,65 +498,108 @@ void UIRenderer::RenderHighscores(SDL_Renderer* r, const Layout& l, const UiFram
     const int x_date = x_score + score_w + gap;
 
     enum class Align { Left, Right, Center };
-    auto draw_text_color = [&](int x, int y, std::string_view text, SDL_Color color) {
-        if (text_renderer_ != nullptr) {
-            text_renderer_->DrawText(r, x, y, text, color, font_size);
-            return;
-        }
-        SDL_Rect rect{x, y, static_cast<int>(text.size()) * 7, font_size};
-        SDL_SetRenderDrawColor(r, color.r, color.g, color.b, color.a);
-        SDL_RenderDrawRect(r, &rect);
-    };
-    auto draw_cell = [&](int x, int y, int width, std::string_view text, Align align, SDL_Color color) {
+    auto cell = [&](int x, int width, std::string text, Align align) {
         int draw_x = x;
-        const int text_w = MeasureTextWidth(text_renderer_, text, font_size);
-        if (align == Align::Right) {
-            draw_x = x + std::max(0, width - text_w);
-        } else if (align == Align::Center) {
-            draw_x = x + std::max(0, (width - text_w) / 2);
+        if (align != Align::Left) {
+            const int text_w = MeasureTextWidth(text_renderer_, text, font_size);
+            draw_x = align == Align::Right ? x + std::max(0, width - text_w) : x + std::max(0, (width - text_w) / 2);
         }
-        draw_text_color(draw_x, y, text, color);
+        return HighscoreCell{draw_x, std::move(text)};
     };
 
-    SDL_Rect header_bg{table_x - 4, cursor_y - 4, table_w + 8, header_h + 6};
-    SDL_SetRenderDrawColor(r, 30, 34, 48, 210);
-    SDL_RenderFillRect(r, &header_bg);
-    const SDL_Color header_text{245, 245, 250, 255};
-    draw_cell(x_rank, cursor_y, rank_w, "Rank", Align::Center, header_text);
-    draw_cell(x_name, cursor_y, name_w, "Name", Align::Left, header_text);
-    draw_cell(x_score, cursor_y, score_w, "Score", Align::Right, header_text);
-    draw_cell(x_date, cursor_y, date_w, "Date", Align::Left, header_text);
+    hc.header_bg = SDL_Rect{table_x - 4, cursor_y - 4, table_w + 8, header_h + 6};
+    hc.header_y = cursor_y;
+    hc.header = {cell(x_rank, rank_w, "Rank", Align::Center),
+                 cell(x_name, name_w, "Name", Align::Left),
+                 cell(x_score, score_w, "Score", Align::Right),
+                 cell(x_date, date_w, "Date", Align::Left)};
     cursor_y += header_h + section_gap;
 
+    hc.empty_y = -1;
     if (ui.highscores == nullptr || ui.highscores->empty() || max_rows == 0) {
-        DrawTextLine(r, cursor_x, cursor_y, "No highscores yet.");
-        cursor_y += row_h;
+        hc.empty_x = cursor_x;
+        hc.empty_y = cursor_y;
     } else {
-        int rank = 1;
         const int rows_to_render = std::min(max_rows, total_rows);
+        hc.rows.reserve(rows_to_render);
         for (int i = 0; i < rows_to_render; ++i) {
             const auto& e = ui.highscores->at(i);
-            SDL_Rect row_rect{table_x - 4, cursor_y - 2, table_w + 8, row_h + 2};
-            if (rank == 1) {
-                SDL_SetRenderDrawColor(r, 48, 60, 82, 190);
-                SDL_RenderFillRect(r, &row_rect);
-            } else if (i % 2 == 1) {
-                SDL_SetRenderDrawColor(r, 24, 24, 34, 180);
-                SDL_RenderFillRect(r, &row_rect);
-            }
-
-            const SDL_Color row_text{230, 230, 230, 255};
-            draw_cell(x_rank, cursor_y, rank_w, std::to_string(rank), Align::Center, row_text);
-            draw_cell(x_name, cursor_y, name_w, e.name, Align::Left, row_text);
-            draw_cell(x_score, cursor_y, score_w, std::to_string(e.score), Align::Right, row_text);
-            draw_cell(x_date, cursor_y, date_w, FormatIsoDate(e.achieved_at), Align::Left, row_text);
+            HighscoreRow row;
+            row.bg = SDL_Rect{table_x - 4, cursor_y - 2, table_w + 8, row_h + 2};
+            row.shade = i == 0 ? 1 : (i % 2 == 1 ? 2 : 0);
+            row.y = cursor_y;
+            row.cells = {cell(x_rank, rank_w, std::to_string(i + 1), Align::Center),
+                         cell(x_name, name_w, e.name, Align::Left),
+                         cell(x_score, score_w, std::to_string(e.score), Align::Right),
+                         cell(x_date, date_w, FormatIsoDate(e.achieved_at), Align::Left)};
+            hc.rows.push_back(std::move(row));
             cursor_y += row_h;
-            ++rank;
         }
     }
 
-    cursor_y = panel.y + panel.h - inner_pad - footer_h;
-    DrawTextLine(r, cursor_x, cursor_y, "Enter: Select  |  Esc: Back");
+    hc.footer_x = cursor_x;
+    hc.footer_y = panel.y + panel.h - inner_pad - footer_h;
+}
+
+void UIRenderer::RenderHighscores(SDL_Renderer* r, const Layout& l, const UiFrameData& ui) {
+    SDL_Rect backdrop{0, 0, l.window_w, l.window_h};
+    SDL_SetRenderDrawColor(r, 10, 10, 16, 230);
+    SDL_RenderFillRect(r, &backdrop);
+
+    SDL_Rect content_rect = l.play_rect;
+    if (content_rect.w <= 0 || content_rect.h <= 0) {
+        content_rect = SDL_Rect{0, 0, l.window_w, l.window_h};
+    }
+
+    const HighscoresCache& hc = highscores_cache_;
+    if (!hc.valid || !SDL_RectEquals(&hc.content, &content_rect) || hc.revision != ui.highscores_revision ||
+        hc.entries != ui.highscores) {
+        BuildHighscores(content_rect, ui);
+    }
+
+    const int font_size = 16;
+    auto draw_text_color = [&](const HighscoreCell& c, int y, SDL_Color color) {
+        if (text_renderer_ != nullptr) {
+            text_renderer_->DrawText(r, c.x, y, c.text, color, font_size);
+            return;
+        }
+        SDL_Rect rect{c.x, y, static_cast<int>(c.text.size()) * 7, font_size};
+        SDL_SetRenderDrawColor(r, color.r, color.g, color.b, color.a);
+        SDL_RenderDrawRect(r, &rect);
+    };
+
+    SDL_SetRenderDrawColor(r, 18, 18, 26, 220);
+    SDL_RenderFillRect(r, &hc.panel);
+    SDL_SetRenderDrawColor(r, 70, 80, 96, 200);
+    SDL_RenderDrawRect(r, &hc.panel);
+
+    DrawTextLine(r, hc.title.x, hc.title_y, hc.title.text);
+
+    SDL_SetRenderDrawColor(r, 30, 34, 48, 210);
+    SDL_RenderFillRect(r, &hc.header_bg);
+    const SDL_Color header_text{245, 245, 250, 255};
+    for (const auto& c : hc.header) {
+        draw_text_color(c, hc.header_y, header_text);
+    }
+
+    if (hc.empty_y >= 0) {
+        DrawTextLine(r, hc.empty_x, hc.empty_y, "No highscores yet.");
+    }
+    const SDL_Color row_text{230, 230, 230, 255};
+    for (const auto& row : hc.rows) {
+        if (row.shade == 1) {
+            SDL_SetRenderDrawColor(r, 48, 60, 82, 190);
+            SDL_RenderFillRect(r, &row.bg);
+        } else if (row.shade == 2) {
+            SDL_SetRenderDrawColor(r, 24, 24, 34, 180);
+            SDL_RenderFillRect(r, &row.bg);
+        }
+        for (const auto& c : row.cells) {
+            draw_text_color(c, row.y, row_text);
+        }
+    }
+
+    DrawTextLine(r, hc.footer_x, hc.footer_y, "Enter: Select  |  Esc: Back");
 }
 
 void UIRenderer::RenderPaused(SDL_Renderer* r, const Layout& l) {
@@ -486,8 +615,8 @@ void UIRenderer::RenderGameOver(SDL_Renderer* r, const Layout& l, const UiFrameD
     SDL_SetRenderDrawColor(r, 0, 0, 0, 160);
     SDL_RenderFillRect(r, &overlay);
     DrawTextLine(r, l.window_w / 2 - 50, l.window_h / 2 - 30, "GAME OVER");
-    DrawTextLine(r, l.window_w / 2 - 80, l.window_h / 2, "Reason: " + ui.game_over_reason);
-    DrawTextLine(r, l.window_w / 2 - 60, l.window_h / 2 + 20, "Score: " + std::to_string(ui.final_score));
+    DrawTextLine(r, l.window_w / 2 - 80, l.window_h / 2, FrameConcat(ui, {"Reason: ", ui.game_over_reason}));
+    DrawTextLine(r, l.window_w / 2 - 60, l.window_h / 2 + 20, ScoreLine(ui.final_score));
     DrawTextLine(r, l.window_w / 2 - 120, l.window_h / 2 + 44, "Enter/R: Restart   Esc: Menu");
 }
 
@@ -500,15 +629,12 @@ void UIRenderer::RenderNameEntry(SDL_Renderer* r, const Layout& l, const UiFrame
     int y = l.window_h / 2 - 80;
     DrawTextLine(r, start_x, y, "NEW HIGHSCORE!");
     y += 28;
-    DrawTextLine(r, start_x, y, "Score: " + std::to_string(ui.final_score));
+    DrawTextLine(r, start_x, y, ScoreLine(ui.final_score));
     y += 28;
     DrawTextLine(r, start_x, y, "Enter name (1-12):");
     y += 28;
 
-    std::string display = ui.name_entry;
-    if (display.size() < 12) {
-        display.push_back('|');
-    }
+    const std::pmr::string display = FrameConcat(ui, {ui.name_entry, ui.name_entry.size() < 12 ? "|" : ""});
     SDL_Rect input_box{start_x - 6, y - 6, 320, 28};
     SDL_SetRenderDrawColor(r, 40, 60, 80, 200);
     SDL_RenderFillRect(r, &input_box);
@@ -2,6 +2,10 @@
 
 #include <SDL.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -30,20 +34,30 @@ struct UiFrameData {
     int menu_index = 0;
     int options_index = 0;
     bool rebinding = false;
-    std::string rebind_action;
+    std::string_view rebind_action;
     int rebind_slot = 0;
     bool pending_round_restart = false;
-    std::string ui_message;
-    std::string lua_error;
-    std::string game_over_reason;
+    std::string_view ui_message;
+    std::string_view lua_error;
+    std::string_view game_over_reason;
     int final_score = 0;
-    std::string name_entry;
+    std::string_view name_entry;
     bool debug_panel_visible = false;
     double effective_tps = 0.0;
+    double time_scale = 1.0;    // simulation fast-forward factor
+    double achieved_tps = 0.0;  // ticks actually simulated per real second
     const snake::io::ConfigData* config = nullptr;
     const std::vector<snake::io::Entry>* highscores = nullptr;
-    std::vector<std::string> menu_items;
-    std::vector<std::pair<std::string, std::string>> option_items;
+    std::uint64_t highscores_revision = 0;  // Highscores::Revision(); keys the retained table
+    const std::vector<std::string>* menu_items = nullptr;
+    const std::vector<std::pair<std::string, std::string>>* option_items = nullptr;
+    double build_ms = 0.0;  // CPU time spent assembling this frame's data (App side)
+    // Scratch memory for this frame's temporaries; reset by the owner before the next frame.
+    // The views above and everything allocated here are only valid during the frame.
+    std::pmr::memory_resource* frame_arena = nullptr;
+    long long heap_allocs_last_frame = -1;  // global operator new calls; -1 = not counted
+    std::size_t arena_last_frame_bytes = 0;
+    std::size_t arena_capacity_bytes = 0;
 };
 
 class UIRenderer {
@@ -55,8 +69,75 @@ public:
                 double now_seconds,
                 const UiFrameData& ui);
 
+    // CPU time of the last Render call (layout + draw submission).
+    double LastRenderMs() const;
+
 private:
+    // Retained panels: text and geometry are rebuilt only when their key changes. Everything
+    // is dropped when the text renderer changes, since widths depend on the font.
+    struct HudCache {
+        bool valid = false;
+        int score = 0;
+        long long tps_centi = 0;
+        int slow_tenths = -1;  // -1: slow inactive
+        bool sim = false;
+        long long sim_scale = 0;
+        long long sim_tps = 0;
+        std::vector<std::string> lines;
+        int line_h = 0;
+        int max_w = 0;
+    };
+    struct PanelCache {
+        bool valid = false;
+        snake::game::Screen screen = snake::game::Screen::MainMenu;
+        int score = 0;
+        int slow_tenths = -1;
+        std::string top_line;
+        std::string effects_line;
+    };
+    struct HighscoreCell {
+        int x = 0;
+        std::string text;
+    };
+    struct HighscoreRow {
+        SDL_Rect bg{};
+        int shade = 0;  // 0: none, 1: leader, 2: alternate row
+        int y = 0;
+        std::array<HighscoreCell, 4> cells;
+    };
+    struct HighscoresCache {
+        bool valid = false;
+        SDL_Rect content{};
+        std::uint64_t revision = 0;
+        const std::vector<snake::io::Entry>* entries = nullptr;
+        SDL_Rect panel{};
+        HighscoreCell title;
+        int title_y = 0;
+        SDL_Rect header_bg{};
+        int header_y = 0;
+        std::array<HighscoreCell, 4> header;
+        std::vector<HighscoreRow> rows;
+        int empty_x = 0;
+        int empty_y = -1;  // >= 0: draw the "no highscores" line here
+        int footer_x = 0;
+        int footer_y = 0;
+    };
+    struct ScoreLineCache {
+        bool valid = false;
+        int score = 0;
+        std::string text;
+    };
+
+    void InvalidateCaches();
+    const std::string& ScoreLine(int score);
+    void BuildHighscores(const SDL_Rect& content, const UiFrameData& ui);
+
     TextRenderer* text_renderer_ = nullptr;
+    HudCache hud_cache_;
+    PanelCache panel_cache_;
+    HighscoresCache highscores_cache_;
+    ScoreLineCache score_line_cache_;
+    double last_render_ms_ = 0.0;
     int DrawTextLine(SDL_Renderer* r, int x, int y, std::string_view s);
     void RenderMenu(SDL_Renderer* r, const Layout& l, const UiFrameData& ui);
     void RenderOptions(SDL_Renderer* r, const Layout& l, const UiFrameData& ui);